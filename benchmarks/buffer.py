@@ -0,0 +1,34 @@
+#
+# moving binary data between tcl and python
+#
+# hashes a tcl binary blob after copying it out with as_byte_array and
+# through the buffer protocol, and passes a bytearray through tcl
+# copied and with tohil.pybuffer.  run with the tohil you want to measure
+# on PYTHONPATH:
+#
+#   python3 benchmarks/buffer.py [megabytes]
+#
+
+import hashlib
+import sys
+import timeit
+
+import tohil
+
+MB = int(sys.argv[1]) if len(sys.argv) > 1 else 16
+
+blob = tohil.tclobj(bytes(range(256)) * (MB * 4096))
+ba = bytearray(bytes(range(256)) * (MB * 4096))
+
+
+def bench(name, fn):
+    t = min(timeit.repeat(fn, number=10, repeat=5)) / 10
+    print(f"{name:40} {t * 1e3:10.3f} ms")
+
+
+bench("as_byte_array", lambda: blob.as_byte_array())
+bench("memoryview", lambda: memoryview(blob).release())
+bench("md5 of as_byte_array", lambda: hashlib.md5(blob.as_byte_array()))
+bench("md5 through the buffer protocol", lambda: hashlib.md5(blob))
+bench("bytearray through tcl", lambda: tohil.setvar("_", ba))
+bench("tohil.pybuffer through tcl", lambda: tohil.setvar("_", tohil.pybuffer(ba)))
@@ -0,0 +1,48 @@
+#
+# list of dicts <-> python columns benchmarks
+#
+# run with the tohil you want to measure on PYTHONPATH:
+#
+#   python3 benchmarks/columns.py [rows]
+#
+
+import sys
+import timeit
+
+import tohil
+
+N = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+
+tohil.eval(
+    """proc tracks {n} {
+    set rows {}
+    for {set i 0} {$i < $n} {incr i} {
+        lappend rows [dict create id $i name track$i lat [expr {$i * 0.5}] lon [expr {$i * 0.25}]]
+    }
+    return $rows
+}"""
+)
+rows = tohil.call("tracks", N, to=tohil.tclobj)
+ids = list(range(N))
+lats = [i * 0.5 for i in range(N)]
+
+
+def by_row():
+    cols = {"id": [], "lat": []}
+    for row in tohil.tclobj(rows, to=tohil.tcldict):
+        cols["id"].append(row.get("id", to=int))
+        cols["lat"].append(row.get("lat", to=float))
+    return cols
+
+
+def bench(name, fn):
+    t = min(timeit.repeat(fn, number=1, repeat=5))
+    print(f"{name:40} {t * 1e3:10.1f} ms")
+
+
+bench("rows with to=tohil.tcldict", by_row)
+bench("tohil.columns, to= types", lambda: tohil.columns(rows, fields=["id", "lat"], types=[int, float]))
+bench("tohil.columns, array typecodes", lambda: tohil.columns(rows, fields=["id", "lat"], types=["q", "d"]))
+bench("tohil.columns, all fields as str", lambda: tohil.columns(rows))
+bench("python rows -> tcl list of dicts", lambda: tohil.tclobj([{"id": i, "lat": l} for i, l in zip(ids, lats)]))
+bench("tohil.from_columns", lambda: tohil.from_columns({"id": ids, "lat": lats}))
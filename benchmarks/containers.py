@@ -0,0 +1,34 @@
+#
+# python container -> tcl conversion benchmarks
+#
+# run with the tohil you want to measure on PYTHONPATH:
+#
+#   python3 benchmarks/containers.py [elements]
+#
+
+import sys
+import timeit
+
+import tohil
+
+N = int(sys.argv[1]) if len(sys.argv) > 1 else 1000000
+
+strs = [str(i) for i in range(N)]
+ints = list(range(N))
+nested = [[i, i + 1] for i in range(N // 2)]
+mapping = {str(i): i for i in range(N)}
+
+
+def bench(name, fn):
+    t = min(timeit.repeat(fn, number=1, repeat=5))
+    print(f"{name:40} {t * 1e3:10.1f} ms")
+
+
+bench("list of str", lambda: tohil.tclobj(strs))
+bench("list of int", lambda: tohil.tclobj(ints))
+bench("tuple of int", lambda: tohil.tclobj(tuple(ints)))
+bench("range", lambda: tohil.tclobj(range(N)))
+bench("list of 2-element lists", lambda: tohil.tclobj(nested))
+bench("dict of str -> int", lambda: tohil.tclobj(mapping))
+bench("set of int", lambda: tohil.tclobj(set(ints)))
+bench("generator of int", lambda: tohil.tclobj(i for i in ints))
@@ -0,0 +1,45 @@
+#
+# string intern cache benchmark
+#
+# converts a tcl list of dicts with the same few keys to python, with the
+# intern cache off and on.  run with the tohil you want to measure on
+# PYTHONPATH:
+#
+#   python3 benchmarks/intern.py [rows]
+#
+
+import sys
+import timeit
+import tracemalloc
+
+import tohil
+
+N = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+
+tohil.eval(
+    """
+    set rows {}
+    for {set i 0} {$i < %d} {incr i} {
+        lappend rows [dict create id x$i name name$i status active kind widget owner nobody]
+    }
+    """
+    % N
+)
+
+
+def bench(name):
+    t = min(timeit.repeat(lambda: tohil.getvar("rows", to=tohil.auto), number=1, repeat=5))
+    tracemalloc.start()
+    rows = tohil.getvar("rows", to=tohil.auto)
+    size = tracemalloc.get_traced_memory()[0]
+    tracemalloc.stop()
+    print(f"{name:40} {t * 1e3:10.1f} ms {size / 1e6:10.1f} MB")
+    return rows
+
+
+rows = bench("intern cache off")
+del rows
+tohil.intern_cache_config(size=4096)
+rows = bench("intern cache on")
+info = tohil.intern_cache_info()
+print(f"hit rate {info['hits'] / (info['hits'] + info['misses']):.1%}")
@@ -0,0 +1,50 @@
+#
+# numeric conversion benchmarks
+#
+# run with the tohil you want to measure on PYTHONPATH:
+#
+#   python3 benchmarks/numeric.py [iterations]
+#
+
+import array
+import sys
+import timeit
+
+import tohil
+
+N = int(sys.argv[1]) if len(sys.argv) > 1 else 200
+
+ints = list(range(-5000, 5000))
+bigints = [(1 << 100) + i for i in range(1000)]
+floats = [i / 7 for i in range(10000)]
+floatarray = array.array("d", floats)
+
+tohil.setvar("ints", ints)
+tohil.setvar("floats", floats)
+tohil.eval("set intsum 0; foreach i $ints {incr intsum $i}")
+tohil.setvar("floatstrings", " ".join(map(str, floats)))
+tohil.eval("set floatsum 0; foreach f $floats {set floatsum [expr {$floatsum + $f}]}")
+tohil.eval("proc sum {l} {set s 0; foreach x $l {set s [expr {$s + $x}]}; return $s}")
+
+
+def bench(name, fn):
+    t = min(timeit.repeat(fn, number=N, repeat=5))
+    print(f"{name:40} {t / N * 1e6:10.1f} us")
+
+
+bench("python int list -> tcl", lambda: tohil.tclobj(ints))
+bench("python bignum list -> tcl", lambda: tohil.tclobj(bigints))
+bench("python float list -> tcl", lambda: tohil.tclobj(floats))
+bench("python int list -> tcl, summed in tcl", lambda: tohil.call("sum", ints))
+bench("python bignum list -> tcl, summed in tcl", lambda: tohil.call("sum", bigints))
+bench("python float list -> tcl, summed in tcl", lambda: tohil.call("sum", floats))
+bench("tcl int list -> python, to=list", lambda: tohil.getvar("ints", to=list))
+bench("tcl int list -> python, to=tohil.auto", lambda: tohil.getvar("ints", to=tohil.auto))
+bench("tcl float list -> python, to=tohil.auto", lambda: tohil.getvar("floats", to=tohil.auto))
+bench("tcl int -> python, to=int", lambda: [tohil.getvar("intsum", to=int) for _ in range(1000)])
+bench("tcl bignum -> python, to=int", lambda: [tohil.expr("1 << 100", to=int) for _ in range(100)])
+bench("tcl float list -> python, to=list + float()", lambda: list(map(float, tohil.getvar("floats", to=list))))
+bench("tcl float list -> python, as_array", lambda: tohil.getvar("floats", to=tohil.tclobj).as_array("d"))
+bench("tcl float string -> python, as_array", lambda: tohil.tclobj(tohil.getvar("floatstrings")).as_array("d"))
+bench("array('d') -> tcl", lambda: tohil.tclobj(floatarray))
+bench("array('d') -> tcl, from_buffer", lambda: tohil.tclobj.from_buffer(floatarray))
@@ -0,0 +1,34 @@
+#
+# passing python objects through tcl, by value and by tohil.pyref
+#
+# stores a python list in a tcl variable and has tcl hand it back
+# to a python function through tohil::call.  run with the tohil you
+# want to measure on PYTHONPATH:
+#
+#   python3 benchmarks/pyref.py [elements]
+#
+
+import sys
+import timeit
+
+import tohil
+
+N = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+
+data = list(range(N))
+
+
+def callback(x):
+    return None
+
+
+sys.modules["__main__"].callback = callback
+
+
+def bench(name, fn):
+    t = min(timeit.repeat(fn, number=10, repeat=5)) / 10
+    print(f"{name:40} {t * 1e3:10.3f} ms")
+
+
+bench("by value", lambda: (tohil.setvar("saved", data), tohil.eval("tohil::call callback $saved")))
+bench("tohil.pyref", lambda: (tohil.setvar("saved", tohil.pyref(data)), tohil.eval("tohil::call callback $saved")))
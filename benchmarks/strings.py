@@ -0,0 +1,49 @@
+#
+# string conversion benchmarks
+#
+# run with the tohil you want to measure on PYTHONPATH:
+#
+#   python3 benchmarks/strings.py [iterations]
+#
+
+import sys
+import timeit
+
+import tohil
+
+N = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+
+tohil.setvar("short", "hello")
+tohil.setvar("long", "the quick brown fox jumps over the lazy dog " * 100)
+tohil.setvar("accented", "façade café naïve résumé " * 10)
+tohil.setvar("cjk", "日本語のテキスト" * 10)
+tohil.setvar("words", [f"word{i}" for i in range(1000)])
+tohil.setvar("keyed", {f"key{i}": f"value{i}" for i in range(1000)})
+
+
+def bench(name, fn, n=N):
+    t = min(timeit.repeat(fn, number=n, repeat=5))
+    print(f"{name:40} {t / n * 1e9:10.0f} ns")
+
+
+short = "hello"
+long = "the quick brown fox jumps over the lazy dog " * 100
+accented = "façade café naïve résumé " * 10
+cjk = "日本語のテキスト" * 10
+words = [f"word{i}" for i in range(1000)]
+
+print("tcl -> python")
+bench("short ascii", lambda: tohil.getvar("short"))
+bench("4.4k ascii", lambda: tohil.getvar("long"))
+bench("250 char latin-1", lambda: tohil.getvar("accented"))
+bench("80 char cjk", lambda: tohil.getvar("cjk"))
+bench("1000 word list, to=list", lambda: tohil.getvar("words", to=list), N // 100)
+bench("1000 pair dict, to=dict", lambda: tohil.getvar("keyed", to=dict), N // 100)
+
+print("python -> tcl")
+bench("short ascii", lambda: tohil.setvar("x", short))
+bench("4.4k ascii", lambda: tohil.setvar("x", long))
+bench("250 char latin-1", lambda: tohil.setvar("x", accented))
+bench("80 char cjk", lambda: tohil.setvar("x", cjk))
+bench("tohil.call with 3 str args", lambda: tohil.call("list", short, accented, cjk))
+bench("1000 word list", lambda: tohil.setvar("x", words), N // 100)
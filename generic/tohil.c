@@ -19,14 +19,23 @@
 #endif
 
 #include <tcl.h>
+#include <tclTomMath.h>
 
 #include <assert.h>
 #include <dlfcn.h>
 
+#include <stddef.h>
 #include <stdio.h>
 
 #define STREQU(a, b) (*(a) == *(b) && strcmp((a), (b)) == 0)
 
+// avoid the allocator for argument vectors up to this size
+#define TOHIL_STATIC_OBJV 16
+
+// stash small integers in pointer-sized internal rep fields
+#define INT2PTR(i) ((void *)(intptr_t)(i))
+#define PTR2INT(p) ((int)(intptr_t)(p))
+
 // forward definitions
 
 // tclobj python data type that consists of a standard python
@@ -38,6 +47,7 @@ typedef struct {
     PyTypeObject *to;
     Tcl_Interp *interp;
     Tcl_Obj *tclobj;
+    int exports; // number of buffers exported from tclobj's byte array
 } TohilTclObj;
 
 int TohilTclObj_Check(PyObject *pyObj);
@@ -48,7 +58,16 @@ int TohilTclDict_Check(PyObject *pyObj);
 static PyTypeObject TohilTclDictType;
 static PyObject *TohilTclDict_FromTclObj(Tcl_Obj *obj);
 
+static PyTypeObject TohilScriptType;
+
 PyObject *tohil_python_return(Tcl_Interp *, int tcl_result, PyTypeObject *toType, Tcl_Obj *resultObj);
+static Tcl_Obj *_pyObjToTcl(Tcl_Interp *interp, PyObject *pObj);
+static PyObject *tohil_TclObjToPyString(Tcl_Obj *obj);
+static Tcl_Obj *tohil_PyUnicodeToTcl(PyObject *pStr);
+static Tcl_ObjType pyObjectObjType;
+static PyObject *tohil_PyObjectObjGet(Tcl_Obj *obj);
+static Tcl_ObjType pyBufferObjType;
+static PyObject *tohil_PyBufferObjGet(Tcl_Obj *obj);
 
 // TCL library begins here
 
@@ -57,12 +76,332 @@ PyObject *tohil_python_return(Tcl_Interp *, int tcl_result, PyTypeObject *toType
 
 static Tcl_Interp *tcl_interp = NULL;
 
-// maintain pointers to our exception handler and python function that
-// we return as our iterator object
-// NB this could be a problem if either of these functions get redefined
+// maintain pointers to our exception handler and exception class
+// NB this could be a problem if either of these get redefined
 static PyObject *pTohilHandleException = NULL;
 static PyObject *pTohilTclErrorClass = NULL;
-static PyObject *tohilTclObjIterator = NULL;
+
+// tcl object types we look at directly, looked up once at startup.
+// wideInt only exists where a long is narrower than a Tcl_WideInt.
+static const Tcl_ObjType *tclListType = NULL;
+static const Tcl_ObjType *tclDictType = NULL;
+static const Tcl_ObjType *tclIntType = NULL;
+static const Tcl_ObjType *tclWideIntType = NULL;
+static const Tcl_ObjType *tclBignumType = NULL;
+static const Tcl_ObjType *tclDoubleType = NULL;
+static const Tcl_ObjType *tclByteArrayType = NULL;
+
+// the most elements we'll put in a tcl list.  tcl panics, rather than
+// failing, if asked for a list whose element array won't fit in an
+// unsigned int of bytes, so we stay a little under that.
+#define TOHIL_LIST_MAX ((Py_ssize_t)(((size_t)UINT_MAX - 64) / sizeof(Tcl_Obj *)))
+
+// the most elements made room for up front on a length hint, which
+// may be wrong
+#define TOHIL_LENGTH_HINT_MAX 1024
+
+//
+//
+// representation churn diagnostics
+//
+// a lot of time can go to changes in tcl objects that nobody asked for:
+// a list shimmered into a dict and back, a string rep regenerated for a
+// big list, a shared list copied whole before appending to it.  with
+// tohil.churn_enable(True), tclobj and tcldict operations and to=
+// conversions note the internal type and string rep of the tcl object
+// they work on before and after, and count the copies they make of
+// shared objects.  tohil.churn_stats() reports it all by operation,
+// and within that by the python file and line that called it.
+//
+//
+
+typedef struct TohilChurnSite {
+    const char *name;
+    int linked;
+    long calls;
+    long shimmers;
+    long stringReps;
+    long stringRepBytes;
+    long dups;
+    long dupElements;
+    long dupBytes;
+    PyObject *transitions; // dict of (from type, to type) -> count
+    PyObject *callers;     // dict of "file:line" -> dict of counts
+    struct TohilChurnSite *next;
+} TohilChurnSite;
+
+typedef struct {
+    TohilChurnSite *site;
+    TohilChurnSite *outer;
+    PyObject *caller;
+    Tcl_Obj *obj;
+    const Tcl_ObjType *typePtr;
+    int hadString;
+    long shimmers;
+    long stringReps;
+    long stringRepBytes;
+    long dups;
+    long dupElements;
+    long dupBytes;
+} TohilChurnCall;
+
+// the counts kept for each operation and caller, in the order
+// tohil_ChurnCountCaller adds them up
+static const char *const churnCountNames[] = {"calls", "shimmers", "string_reps", "string_rep_bytes", "dups", "dup_elements", "dup_bytes", NULL};
+
+static int churnEnabled = 0;
+static TohilChurnSite *churnSites = NULL;
+static TohilChurnSite *churnCurrentSite = NULL;
+
+//
+// tohil_ChurnCaller - return "file:line" of the python code running, or
+//   NULL if there isn't any
+//
+static PyObject *
+tohil_ChurnCaller(void)
+{
+#ifndef PYPY_VERSION
+    PyFrameObject *frame = PyEval_GetFrame();
+    if (frame == NULL) {
+        return NULL;
+    }
+#if PY_VERSION_HEX >= 0x03090000
+    PyCodeObject *code = PyFrame_GetCode(frame);
+    PyObject *pCaller = PyUnicode_FromFormat("%U:%d", code->co_filename, PyFrame_GetLineNumber(frame));
+    Py_DECREF(code);
+#else
+    PyObject *pCaller = PyUnicode_FromFormat("%U:%d", frame->f_code->co_filename, PyFrame_GetLineNumber(frame));
+#endif
+    if (pCaller == NULL) {
+        PyErr_Clear();
+    }
+    return pCaller;
+#else
+    return NULL;
+#endif
+}
+
+//
+// tohil_ChurnAddCounts - add the counts in pFrom to those in pInto.
+//   returns -1 with a python error if that fails.
+//
+static int
+tohil_ChurnAddCounts(PyObject *pInto, PyObject *pFrom)
+{
+    for (int i = 0; churnCountNames[i] != NULL; i++) {
+        PyObject *pSum = PyNumber_Add(PyDict_GetItemString(pInto, churnCountNames[i]), PyDict_GetItemString(pFrom, churnCountNames[i]));
+        if (pSum == NULL || PyDict_SetItemString(pInto, churnCountNames[i], pSum) < 0) {
+            Py_XDECREF(pSum);
+            return -1;
+        }
+        Py_DECREF(pSum);
+    }
+    return 0;
+}
+
+//
+// tohil_ChurnBegin - note the state of obj as the operation at site starts
+//
+static void
+tohil_ChurnBegin(TohilChurnCall *call, TohilChurnSite *site, Tcl_Obj *obj)
+{
+    if (!site->linked) {
+        site->linked = 1;
+        site->next = churnSites;
+        churnSites = site;
+    }
+    site->calls++;
+
+    call->site = site;
+    call->outer = churnCurrentSite;
+    call->obj = obj;
+    call->typePtr = obj->typePtr;
+    call->hadString = (obj->bytes != NULL);
+    call->shimmers = site->shimmers;
+    call->stringReps = site->stringReps;
+    call->stringRepBytes = site->stringRepBytes;
+    call->dups = site->dups;
+    call->dupElements = site->dupElements;
+    call->dupBytes = site->dupBytes;
+    call->caller = tohil_ChurnCaller();
+    churnCurrentSite = site;
+}
+
+//
+// tohil_ChurnCountCaller - add what the call counted against its site
+//   to the site's counts for the python code that made the call
+//
+static void
+tohil_ChurnCountCaller(TohilChurnCall *call)
+{
+    TohilChurnSite *site = call->site;
+    if (call->caller == NULL) {
+        return;
+    }
+    long deltas[] = {1,
+                     site->shimmers - call->shimmers,
+                     site->stringReps - call->stringReps,
+                     site->stringRepBytes - call->stringRepBytes,
+                     site->dups - call->dups,
+                     site->dupElements - call->dupElements,
+                     site->dupBytes - call->dupBytes};
+
+    // a python error may be on its way out of the operation
+    PyObject *pType, *pVal, *pTrace;
+    PyErr_Fetch(&pType, &pVal, &pTrace);
+    if (site->callers == NULL) {
+        site->callers = PyDict_New();
+    }
+    PyObject *pCounts = (site->callers == NULL) ? NULL : PyDict_GetItemWithError(site->callers, call->caller);
+    if (pCounts == NULL && site->callers != NULL && !PyErr_Occurred()) {
+        pCounts = PyDict_New();
+        for (int i = 0; pCounts != NULL && churnCountNames[i] != NULL; i++) {
+            PyObject *pZero = PyLong_FromLong(0);
+            if (pZero == NULL || PyDict_SetItemString(pCounts, churnCountNames[i], pZero) < 0) {
+                Py_CLEAR(pCounts);
+            }
+            Py_XDECREF(pZero);
+        }
+        if (pCounts != NULL && PyDict_SetItem(site->callers, call->caller, pCounts) < 0) {
+            Py_CLEAR(pCounts);
+        }
+        // the callers dict holds it now
+        Py_XDECREF(pCounts);
+    }
+    for (int i = 0; pCounts != NULL && churnCountNames[i] != NULL; i++) {
+        PyObject *pCount = PyLong_FromLong(PyLong_AsLong(PyDict_GetItemString(pCounts, churnCountNames[i])) + deltas[i]);
+        if (pCount != NULL) {
+            PyDict_SetItemString(pCounts, churnCountNames[i], pCount);
+            Py_DECREF(pCount);
+        }
+    }
+    Py_CLEAR(call->caller);
+    PyErr_Clear();
+    PyErr_Restore(pType, pVal, pTrace);
+}
+
+//
+// tohil_ChurnCount - compare obj against what tohil_ChurnBegin saw and
+//   count what changed.  an operation that replaced the object with
+//   an unrelated one (set, getvar) isn't counted, one that copied it
+//   before changing it is, against the copy.
+//
+static void
+tohil_ChurnCount(TohilChurnCall *call, Tcl_Obj *obj)
+{
+    TohilChurnSite *site = call->site;
+
+    if (obj != call->obj && site->dups == call->dups) {
+        return;
+    }
+
+    if (!call->hadString && obj->bytes != NULL) {
+        site->stringReps++;
+        site->stringRepBytes += obj->length;
+    }
+
+    if (obj->typePtr == call->typePtr) {
+        return;
+    }
+    if (call->typePtr != NULL && obj->typePtr != NULL) {
+        site->shimmers++;
+    }
+
+    // a python error may be on its way out of the operation
+    PyObject *pType, *pVal, *pTrace;
+    PyErr_Fetch(&pType, &pVal, &pTrace);
+    if (site->transitions == NULL) {
+        site->transitions = PyDict_New();
+    }
+    PyObject *pKey = Py_BuildValue("(zz)", call->typePtr ? call->typePtr->name : NULL, obj->typePtr ? obj->typePtr->name : NULL);
+    if (site->transitions != NULL && pKey != NULL) {
+        PyObject *pCount = PyDict_GetItemWithError(site->transitions, pKey);
+        long count = (pCount == NULL) ? 0 : PyLong_AsLong(pCount);
+        pCount = PyLong_FromLong(count + 1);
+        if (pCount != NULL) {
+            PyDict_SetItem(site->transitions, pKey, pCount);
+            Py_DECREF(pCount);
+        }
+    }
+    Py_XDECREF(pKey);
+    PyErr_Clear();
+    PyErr_Restore(pType, pVal, pTrace);
+}
+
+//
+// tohil_ChurnEnd - count what the operation did to obj, as a whole and
+//   for its caller
+//
+static void
+tohil_ChurnEnd(TohilChurnCall *call, Tcl_Obj *obj)
+{
+    churnCurrentSite = call->outer;
+    tohil_ChurnCount(call, obj);
+    tohil_ChurnCountCaller(call);
+}
+
+//
+// tohil_ChurnDup - count a copy about to be made of a shared object
+//   against the operation that's making it
+//
+static void
+tohil_ChurnDup(Tcl_Obj *obj)
+{
+    if (!churnEnabled || churnCurrentSite == NULL) {
+        return;
+    }
+
+    int size = 0;
+    if (obj->typePtr == tclListType) {
+        Tcl_ListObjLength(NULL, obj, &size);
+    } else if (obj->typePtr == tclDictType) {
+        Tcl_DictObjSize(NULL, obj, &size);
+    }
+    churnCurrentSite->dups++;
+    churnCurrentSite->dupElements += size;
+    churnCurrentSite->dupBytes += (obj->bytes != NULL) ? obj->length : 0;
+}
+
+//
+// TohilTclObj_Exported - if a buffer has been exported from a tclobj's
+//   byte array, set a BufferError and return 1.  the exported bytes are
+//   the byte array's internal rep, so nothing may convert or change the
+//   tcl object, or give it to anyone who could, until they're released.
+//
+static int
+TohilTclObj_Exported(TohilTclObj *self)
+{
+    if (self->exports == 0) {
+        return 0;
+    }
+    PyErr_SetString(PyExc_BufferError, "tclobj can't be used this way while it has exported buffers");
+    return 1;
+}
+
+//
+// TOHIL_TCLOBJ_OP - define wrapper, a version of fn that records churn
+//   under siteName when churn diagnostics are on.  if locks is set, it
+//   also refuses, returning errval, while the tclobj has exported
+//   buffers.  params and args are fn's parenthesized parameter list and
+//   the call passing them along, and the first parameter has to be the
+//   tclobj, called self.
+//
+#define TOHIL_TCLOBJ_OP(wrapper, rettype, fn, siteName, locks, errval, params, args) \
+    static rettype wrapper params                                                   \
+    {                                                                               \
+        static TohilChurnSite churnSite = {siteName};                               \
+        TohilChurnCall churnCall;                                                   \
+        if ((locks) && TohilTclObj_Exported((TohilTclObj *)self)) {                 \
+            return errval;                                                          \
+        }                                                                           \
+        if (!churnEnabled) {                                                        \
+            return fn args;                                                         \
+        }                                                                           \
+        tohil_ChurnBegin(&churnCall, &churnSite, ((TohilTclObj *)self)->tclobj);    \
+        rettype result = fn args;                                                   \
+        tohil_ChurnEnd(&churnCall, ((TohilTclObj *)self)->tclobj);                  \
+        return result;                                                              \
+    }
 
 #ifndef PYPY_VERSION
 static const char *pythonLibName = "libpython" PYTHON_VERSION ".so";
@@ -101,6 +440,55 @@ tohil_UTF8ToTcl(char *utf8String, int utf8StringLen, Tcl_DString *ds)
     return Tcl_ExternalToUtfDString(utf8encoding, utf8String, utf8StringLen, ds);
 }
 
+//
+// tcl objects that are dicts can be converted as lists, but getting
+// their elements with Tcl_ListObjGetElements shimmers them into lists,
+// throwing away the hash table that the next dict get would need.  so
+// conversions walk the dict rep when there is one.
+//
+
+//
+// tclDictObjToPySequence - make a python list, or tuple if tuple is set,
+//   of the keys and values of a tcl object with a dict internal rep
+//
+static PyObject *
+tclDictObjToPySequence(Tcl_Interp *interp, Tcl_Obj *dictObj, int tuple)
+{
+    Tcl_DictSearch search;
+    Tcl_Obj *keyObj, *valueObj;
+    int size, done;
+
+    if (Tcl_DictObjSize(interp, dictObj, &size) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        return NULL;
+    }
+
+    PyObject *pseq = tuple ? PyTuple_New(size * 2) : PyList_New(size * 2);
+    if (pseq == NULL) {
+        return NULL;
+    }
+
+    Tcl_DictObjFirst(interp, dictObj, &search, &keyObj, &valueObj, &done);
+    for (int i = 0; !done; Tcl_DictObjNext(&search, &keyObj, &valueObj, &done), i += 2) {
+        PyObject *pKey = tohil_TclObjToPyString(keyObj);
+        PyObject *pValue = (pKey == NULL) ? NULL : tohil_TclObjToPyString(valueObj);
+        if (pValue == NULL) {
+            Py_XDECREF(pKey);
+            Py_DECREF(pseq);
+            Tcl_DictObjDone(&search);
+            return NULL;
+        }
+        if (tuple) {
+            PyTuple_SET_ITEM(pseq, i, pKey);
+            PyTuple_SET_ITEM(pseq, i + 1, pValue);
+        } else {
+            PyList_SET_ITEM(pseq, i, pKey);
+            PyList_SET_ITEM(pseq, i + 1, pValue);
+        }
+    }
+    return pseq;
+}
+
 //
 // turn a tcl list into a python list
 //
@@ -110,17 +498,27 @@ tclListObjToPyListObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
     Tcl_Obj **list;
     int count;
 
+    if (inputObj->typePtr == tclDictType) {
+        return tclDictObjToPySequence(interp, inputObj, 0);
+    }
+
     if (Tcl_ListObjGetElements(interp, inputObj, &count, &list) == TCL_ERROR) {
         PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
         return NULL;
     }
 
     PyObject *plist = PyList_New(count);
+    if (plist == NULL) {
+        return NULL;
+    }
 
     for (int i = 0; i < count; i++) {
-        Tcl_DString ds;
-        PyList_SET_ITEM(plist, i, Py_BuildValue("s", tohil_TclObjToUTF8(list[i], &ds)));
-        Tcl_DStringFree(&ds);
+        PyObject *pElement = tohil_TclObjToPyString(list[i]);
+        if (pElement == NULL) {
+            Py_DECREF(plist);
+            return NULL;
+        }
+        PyList_SET_ITEM(plist, i, pElement);
     }
 
     return plist;
@@ -135,19 +533,46 @@ tclListObjToPySetObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
     Tcl_Obj **list;
     int count;
 
+    PyObject *pset = PySet_New(NULL);
+    if (pset == NULL) {
+        return NULL;
+    }
+
+    if (inputObj->typePtr == tclDictType) {
+        Tcl_DictSearch search;
+        Tcl_Obj *pair[2];
+        int done;
+
+        Tcl_DictObjFirst(interp, inputObj, &search, &pair[0], &pair[1], &done);
+        for (; !done; Tcl_DictObjNext(&search, &pair[0], &pair[1], &done)) {
+            for (int i = 0; i < 2; i++) {
+                PyObject *pElement = tohil_TclObjToPyString(pair[i]);
+                if (pElement == NULL || PySet_Add(pset, pElement) < 0) {
+                    Py_XDECREF(pElement);
+                    Py_DECREF(pset);
+                    Tcl_DictObjDone(&search);
+                    return NULL;
+                }
+                Py_DECREF(pElement);
+            }
+        }
+        return pset;
+    }
+
     if (Tcl_ListObjGetElements(interp, inputObj, &count, &list) == TCL_ERROR) {
         PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        Py_DECREF(pset);
         return NULL;
     }
 
-    PyObject *pset = PySet_New(NULL);
-
     for (int i = 0; i < count; i++) {
-        Tcl_DString ds;
-        if (PySet_Add(pset, Py_BuildValue("s", tohil_TclObjToUTF8(list[i], &ds))) < 0) {
+        PyObject *pElement = tohil_TclObjToPyString(list[i]);
+        if (pElement == NULL || PySet_Add(pset, pElement) < 0) {
+            Py_XDECREF(pElement);
+            Py_DECREF(pset);
             return NULL;
         }
-        Tcl_DStringFree(&ds);
+        Py_DECREF(pElement);
     }
 
     return pset;
@@ -162,24 +587,34 @@ tclListObjToPyTupleObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
     Tcl_Obj **list;
     int count;
 
+    if (inputObj->typePtr == tclDictType) {
+        return tclDictObjToPySequence(interp, inputObj, 1);
+    }
+
     if (Tcl_ListObjGetElements(interp, inputObj, &count, &list) == TCL_ERROR) {
         PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
         return NULL;
     }
 
     PyObject *ptuple = PyTuple_New(count);
+    if (ptuple == NULL) {
+        return NULL;
+    }
 
     for (int i = 0; i < count; i++) {
-        Tcl_DString ds;
-        PyTuple_SET_ITEM(ptuple, i, Py_BuildValue("s", tohil_TclObjToUTF8(list[i], &ds)));
-        Tcl_DStringFree(&ds);
+        PyObject *pElement = tohil_TclObjToPyString(list[i]);
+        if (pElement == NULL) {
+            Py_DECREF(ptuple);
+            return NULL;
+        }
+        PyTuple_SET_ITEM(ptuple, i, pElement);
     }
 
     return ptuple;
 }
 
 //
-// turn a tcl list of key-value pairs into a python dict
+// turn a tcl dict, or a list of key-value pairs, into a python dict
 //
 PyObject *
 tclListObjToPyDictObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
@@ -187,6 +622,33 @@ tclListObjToPyDictObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
     Tcl_Obj **list;
     int count;
 
+    if (inputObj->typePtr == tclDictType) {
+        Tcl_DictSearch search;
+        Tcl_Obj *keyObj, *valueObj;
+        int done;
+
+        PyObject *pdict = PyDict_New();
+        if (pdict == NULL) {
+            return NULL;
+        }
+
+        Tcl_DictObjFirst(interp, inputObj, &search, &keyObj, &valueObj, &done);
+        for (; !done; Tcl_DictObjNext(&search, &keyObj, &valueObj, &done)) {
+            PyObject *pKey = tohil_TclObjToPyString(keyObj);
+            PyObject *pValue = (pKey == NULL) ? NULL : tohil_TclObjToPyString(valueObj);
+            if (pValue == NULL || PyDict_SetItem(pdict, pKey, pValue) < 0) {
+                Py_XDECREF(pKey);
+                Py_XDECREF(pValue);
+                Py_DECREF(pdict);
+                Tcl_DictObjDone(&search);
+                return NULL;
+            }
+            Py_DECREF(pKey);
+            Py_DECREF(pValue);
+        }
+        return pdict;
+    }
+
     if (Tcl_ListObjGetElements(interp, inputObj, &count, &list) == TCL_ERROR) {
         PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
         return NULL;
@@ -199,14 +661,21 @@ tclListObjToPyDictObject(Tcl_Interp *interp, Tcl_Obj *inputObj)
     }
 
     PyObject *pdict = PyDict_New();
+    if (pdict == NULL) {
+        return NULL;
+    }
 
     for (int i = 0; i < count; i += 2) {
-        Tcl_DString kds, vds;
-        char *key = tohil_TclObjToUTF8(list[i], &kds);
-        char *val = tohil_TclObjToUTF8(list[i + 1], &vds);
-        PyDict_SetItem(pdict, Py_BuildValue("s", key), Py_BuildValue("s", val));
-        Tcl_DStringFree(&kds);
-        Tcl_DStringFree(&vds);
+        PyObject *pKey = tohil_TclObjToPyString(list[i]);
+        PyObject *pValue = (pKey == NULL) ? NULL : tohil_TclObjToPyString(list[i + 1]);
+        if (pValue == NULL || PyDict_SetItem(pdict, pKey, pValue) < 0) {
+            Py_XDECREF(pKey);
+            Py_XDECREF(pValue);
+            Py_DECREF(pdict);
+            return NULL;
+        }
+        Py_DECREF(pKey);
+        Py_DECREF(pValue);
     }
 
     return pdict;
@@ -277,2486 +746,6871 @@ tohil_TclToUTF8(char *src, int srclen, char **res, int *reslen)
 }
 
 //
-// turn a tcl object into a python object by trying to convert it as a boolean,
-// then a long, then a double and finally a string
+// tohil_TclStringToPyNew - make a new python str from a tcl string
 //
-// NB not currently used, and could be better by peeking first at the tcl
-// object's internal rep.  i have concerns about using this because the python
-// dev may be surprised to get an int or float back instead of a string.
-// not sure but not ready to get rid of this; it still seems promising
+// tcl keeps strings in utf-8, except that NUL is stored as C0 80 and
+// characters beyond the BMP as pairs of encoded surrogates.  nearly all
+// strings have neither, and those can go straight to python in a single
+// copy.  pure ascii, the commonest case of all, is copied directly into
+// a new str.  only strings that need it go through tcl's utf-8 encoder.
 //
+#define TOHIL_HIGH_BITS ((size_t)-1 / 0xff * 0x80)
+
 static PyObject *
-tclObjToPy(Tcl_Obj *tObj)
+tohil_TclStringToPyNew(const char *src, int srclen)
 {
-    int intValue;
-    long longValue;
-    double doubleValue;
-
-    if (Tcl_GetBooleanFromObj(NULL, tObj, &intValue) == TCL_OK) {
-        PyObject *p = (intValue ? Py_True : Py_False);
-        Py_INCREF(p);
-        return p;
+    const unsigned char *p = (const unsigned char *)src;
+    const unsigned char *end = p + srclen;
+    int ascii = 1;
+
+    // skip through ascii a word at a time, looking at individual
+    // bytes only in words that have something else in them
+    while (p < end) {
+        if (end - p >= (ptrdiff_t)sizeof(size_t)) {
+            size_t word;
+            memcpy(&word, p, sizeof(word));
+            if ((word & TOHIL_HIGH_BITS) == 0) {
+                p += sizeof(size_t);
+                continue;
+            }
+        }
+        if (*p >= 0x80) {
+            ascii = 0;
+            if (*p == 0xc0 || (*p == 0xed && p + 1 < end && p[1] >= 0xa0)) {
+                goto convert;
+            }
+        }
+        p++;
     }
 
-    if (Tcl_GetLongFromObj(NULL, tObj, &longValue) == TCL_OK) {
-        return PyLong_FromLong(longValue);
+#ifndef PYPY_VERSION
+    if (ascii) {
+        PyObject *pStr = PyUnicode_New(srclen, 127);
+        if (pStr != NULL) {
+            memcpy(PyUnicode_1BYTE_DATA(pStr), src, srclen);
+        }
+        return pStr;
     }
+#endif
 
-    if (Tcl_GetDoubleFromObj(NULL, tObj, &doubleValue) == TCL_OK) {
-        return PyFloat_FromDouble(doubleValue);
+    PyObject *pStr = PyUnicode_DecodeUTF8(src, srclen, NULL);
+    if (pStr != NULL || !PyErr_ExceptionMatches(PyExc_UnicodeDecodeError)) {
+        return pStr;
     }
+    // not valid utf-8 as it stands, let tcl sort it out
+    PyErr_Clear();
 
-    int tclStringSize;
-    char *tclString;
-    tclString = Tcl_GetStringFromObj(tObj, &tclStringSize);
-
-    int utf8len;
+convert:;
     char *utf8string;
-    if (tohil_TclToUTF8(tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(tcl_interp)));
+    int utf8len;
+    if (tohil_TclToUTF8((char *)src, srclen, &utf8string, &utf8len) != TCL_OK) {
+        PyErr_SetString(PyExc_RuntimeError, "unable to convert tcl string to utf-8");
         return NULL;
     }
-    PyObject *pObj = Py_BuildValue("s#", utf8string, utf8len);
+    pStr = PyUnicode_DecodeUTF8(utf8string, utf8len, NULL);
     ckfree(utf8string);
-    return pObj;
+    return pStr;
 }
 
 //
-// convert a python object to a tcl object - amazing code by aidan
 //
-static Tcl_Obj *
-_pyObjToTcl(Tcl_Interp *interp, PyObject *pObj)
+// string intern cache
+//
+// converting tcl lists of dicts to python makes the same few field
+// names over and over.  when turned on with tohil.intern_cache_config,
+// short strings coming back from tcl are looked up by their tcl bytes
+// in a direct-mapped table of python strs, and repeats get the same,
+// interned, str back instead of a new one.  a string that hashes to an
+// occupied slot replaces what was there, so the table never grows.
+//
+//
+
+// longest string max_length can be set to
+#define TOHIL_INTERN_MAX_LENGTH_LIMIT 255
+
+typedef struct {
+    PyObject *str;
+    unsigned int hash;
+    int length;
+} TohilInternEntry;
+
+static struct {
+    TohilInternEntry *slots;
+    char *bytes; // maxLength bytes for each slot's tcl string
+    int nSlots;  // a power of two, 0 when the cache is off
+    int maxLength;
+    int used;
+    long hits;
+    long misses;
+} internCache = {NULL, NULL, 0, 32, 0, 0, 0};
+
+//
+// release every string in the intern cache, leaving it empty
+//
+static void
+tohil_InternCacheEmpty(void)
 {
-    Tcl_Obj *tObj;
-    PyObject *pBytesObj;
-    PyObject *pStrObj;
+    for (int i = 0; i < internCache.nSlots; i++) {
+        Py_CLEAR(internCache.slots[i].str);
+    }
+    internCache.used = 0;
+}
 
-    Py_ssize_t i, len;
-    PyObject *pVal = NULL;
-    Tcl_Obj *tVal;
+//
+// tohil_InternString - return the python str for a short tcl string,
+//   from the intern cache if it's there, converting and caching it
+//   if it isn't
+//
+static PyObject *
+tohil_InternString(const char *src, int srclen)
+{
+    // FNV-1a
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < srclen; i++) {
+        hash = (hash ^ (unsigned char)src[i]) * 16777619u;
+    }
 
-    PyObject *pItems = NULL;
-    PyObject *pItem = NULL;
-    PyObject *pKey = NULL;
-    Tcl_Obj *tKey;
+    unsigned int slot = hash & (internCache.nSlots - 1);
+    TohilInternEntry *entry = &internCache.slots[slot];
+    char *entryBytes = internCache.bytes + (size_t)slot * internCache.maxLength;
+    if (entry->str != NULL && entry->hash == hash && entry->length == srclen && memcmp(entryBytes, src, srclen) == 0) {
+        internCache.hits++;
+        Py_INCREF(entry->str);
+        return entry->str;
+    }
+    internCache.misses++;
 
-    char *utf8string;
-    int utf8len;
+    PyObject *pStr = tohil_TclStringToPyNew(src, srclen);
+    if (pStr == NULL) {
+        return NULL;
+    }
+    PyUnicode_InternInPlace(&pStr);
 
-    /*
-     * The ordering must always be more 'specific' types first. E.g. a
-     * string also obeys the sequence protocol...but we probably want it
-     * to be a string rather than a list. Suggested order below:
-     * - None -> {}
-     * - True -> 1, False -> 0
-     * - tclobj -> tclobj
-     * - tcldict -> tcldict
-     * - bytes -> tcl byte string
-     * - unicode -> tcl unicode string
-     * - number protocol -> tcl number
-     * - sequence protocol -> tcl list
-     * - mapping protocol -> tcl dict
-     * - other -> error (currently converts to string)
-     *
-     * Note that the sequence and mapping protocol are both determined by __getitem__,
-     * the only difference is that dict subclasses are excluded from sequence.
-     */
+    if (entry->str == NULL) {
+        internCache.used++;
+    } else {
+        Py_DECREF(entry->str);
+    }
+    Py_INCREF(pStr);
+    entry->str = pStr;
+    entry->hash = hash;
+    entry->length = srclen;
+    memcpy(entryBytes, src, srclen);
+    return pStr;
+}
 
-    if (pObj == Py_None) {
-        tObj = Tcl_NewObj();
-    } else if (pObj == Py_True || pObj == Py_False) {
-        tObj = Tcl_NewBooleanObj(pObj == Py_True);
-    } else if (TohilTclObj_Check(pObj) || TohilTclDict_Check(pObj)) {
-        TohilTclObj *pyTclObj = (TohilTclObj *)pObj;
-        tObj = pyTclObj->tclobj;
-    } else if (PyBytes_Check(pObj)) {
-        tObj = Tcl_NewByteArrayObj((const unsigned char *)PyBytes_AS_STRING(pObj), PyBytes_GET_SIZE(pObj));
-    } else if (PyUnicode_Check(pObj)) {
-        pBytesObj = PyUnicode_AsUTF8String(pObj);
-        if (pBytesObj == NULL)
-            return NULL;
-        if (tohil_UTF8toTcl(PyBytes_AS_STRING(pBytesObj), PyBytes_GET_SIZE(pBytesObj), &utf8string, &utf8len) != TCL_OK) {
-            Py_DECREF(pBytesObj);
-            return NULL;
-        }
-        tObj = Tcl_NewStringObj(utf8string, utf8len);
-        ckfree(utf8string);
-        Py_DECREF(pBytesObj);
-    } else if (PyNumber_Check(pObj)) {
-        /* We go via string to support arbitrary length numbers */
-        if (PyLong_Check(pObj)) {
-#ifndef PYPY_VERSION
-            pStrObj = PyNumber_ToBase(pObj, 10);
-#else
-            pStrObj = PyObject_Str(pObj);
-#endif
-        } else {
-            assert(PyComplex_Check(pObj) || PyFloat_Check(pObj));
-            pStrObj = PyObject_Str(pObj);
-        }
-        if (pStrObj == NULL)
-            return NULL;
-        pBytesObj = PyUnicode_AsUTF8String(pStrObj);
-        Py_DECREF(pStrObj);
-        if (pBytesObj == NULL)
-            return NULL;
-        if (tohil_UTF8toTcl(PyBytes_AS_STRING(pBytesObj), PyBytes_GET_SIZE(pBytesObj), &utf8string, &utf8len) != TCL_OK) {
-            Py_DECREF(pBytesObj);
-            return NULL;
-        }
-        tObj = Tcl_NewStringObj(utf8string, utf8len);
-        ckfree(utf8string);
-        Py_DECREF(pBytesObj);
-    } else if (PySequence_Check(pObj)) {
-        tObj = Tcl_NewListObj(0, NULL);
-        len = PySequence_Length(pObj);
-        if (len == -1)
-            return NULL;
-
-        for (i = 0; i < len; i++) {
-            pVal = PySequence_GetItem(pObj, i);
-            if (pVal == NULL)
-                return NULL;
-            tVal = _pyObjToTcl(interp, pVal);
-            Py_DECREF(pVal);
-            if (tVal == NULL)
-                return NULL;
-            Tcl_ListObjAppendElement(interp, tObj, tVal);
-        }
-    } else if (PyMapping_Check(pObj)) {
-        tObj = Tcl_NewDictObj();
-        len = PyMapping_Length(pObj);
-        if (len == -1)
-            return NULL;
-        pItems = PyMapping_Items(pObj);
-        if (pItems == NULL)
-            return NULL;
-#define ONERR(VAR)         \
-    if (VAR == NULL) {     \
-        Py_DECREF(pItems); \
-        return NULL;       \
-    }
-        for (i = 0; i < len; i++) {
-            pItem = PySequence_GetItem(pItems, i);
-            ONERR(pItem)
-            pKey = PySequence_GetItem(pItem, 0);
-            ONERR(pKey)
-            pVal = PySequence_GetItem(pItem, 1);
-            ONERR(pVal)
-            tKey = _pyObjToTcl(interp, pKey);
-            Py_DECREF(pKey);
-            ONERR(tKey);
-            tVal = _pyObjToTcl(interp, pVal);
-            Py_DECREF(pVal);
-            ONERR(tVal);
-            Tcl_DictObjPut(interp, tObj, tKey, tVal);
-        }
-#undef ONERR
-        Py_DECREF(pItems);
-        /* Broke out of loop because of error */
-        if (i != len) {
-            Py_XDECREF(pItem);
-            return NULL;
-        }
-    } else {
-        /* Get python string representation of other objects */
-        pStrObj = PyObject_Str(pObj);
-        if (pStrObj == NULL)
-            return NULL;
-        pBytesObj = PyUnicode_AsUTF8String(pStrObj);
-        Py_DECREF(pStrObj);
-        if (pBytesObj == NULL)
-            return NULL;
-        if (tohil_UTF8toTcl(PyBytes_AS_STRING(pBytesObj), PyBytes_GET_SIZE(pBytesObj), &utf8string, &utf8len) != TCL_OK) {
-            Py_DECREF(pBytesObj);
-            return NULL;
-        }
-        tObj = Tcl_NewStringObj(utf8string, utf8len);
-        ckfree(utf8string);
-        Py_DECREF(pBytesObj);
+//
+// tohil_TclStringToPy - make a python str from a tcl string, through
+//   the intern cache if it's on and the string is short enough
+//
+static PyObject *
+tohil_TclStringToPy(const char *src, int srclen)
+{
+    if (internCache.nSlots > 0 && srclen <= internCache.maxLength) {
+        return tohil_InternString(src, srclen);
     }
+    return tohil_TclStringToPyNew(src, srclen);
+}
 
-    return tObj;
+//
+//
+// tcl "pystr" object type
+//
+// a tcl value read from python over and over, like a configuration
+// variable or a constant list element, would otherwise be transcoded
+// into a new python str every time.  with tohil.pystr_cache(True), a
+// pure string tcl object keeps the str made from it in its internal
+// rep, and later conversions hand that back.  objects that already
+// have some other internal rep are left alone.
+//
+// tcl only changes a value's string after converting it to a type of
+// its own, which frees our rep and the str with it, so the cached str
+// can't go stale.
+//
+// internalRep.twoPtrValue.ptr1 is the python str, which we hold a
+// reference to.
+//
+//
+
+static int pyStrCacheEnabled = 0;
+
+static void PyStrObj_FreeIntRep(Tcl_Obj *obj);
+static void PyStrObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj);
+static void PyStrObj_UpdateString(Tcl_Obj *obj);
+
+static Tcl_ObjType pyStrObjType = {
+    "pystr",               // name
+    PyStrObj_FreeIntRep,   // freeIntRepProc
+    PyStrObj_DupIntRep,    // dupIntRepProc
+    PyStrObj_UpdateString, // updateStringProc
+    NULL,                  // setFromAnyProc
+};
+
+static void
+PyStrObj_FreeIntRep(Tcl_Obj *obj)
+{
+    // python may already be gone if tcl is cleaning up at exit
+    if (Py_IsInitialized()) {
+        PyGILState_STATE gilState = PyGILState_Ensure();
+        Py_DECREF((PyObject *)obj->internalRep.twoPtrValue.ptr1);
+        PyGILState_Release(gilState);
+    }
+    obj->typePtr = NULL;
 }
 
-static Tcl_Obj *
-pyObjToTcl(Tcl_Interp *interp, PyObject *pObj)
+static void
+PyStrObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj)
 {
-    Tcl_Obj *ret = _pyObjToTcl(interp, pObj);
-    // NB tcl is not prepared to accept null pointers to set interpreter results
-    // and probably even variables and stuff yet pyObjToTcl can return them.
-    // here we look to detect if it does.  later we might choose to cause an
-    // error return or some kind, or, if necessary, do checks
-    // everywhere in the code that currently assumes pyObjToTcl can't fail
-    assert(ret != NULL);
-    if (ret == NULL)
-        abort();
-    return ret;
+    PyObject *pStr = (PyObject *)srcObj->internalRep.twoPtrValue.ptr1;
+    PyGILState_STATE gilState = PyGILState_Ensure();
+    Py_INCREF(pStr);
+    PyGILState_Release(gilState);
+    dupObj->internalRep.twoPtrValue.ptr1 = pStr;
+    dupObj->typePtr = &pyStrObjType;
 }
 
 //
-// PyReturnTclError - return a tcl error to the tcl interpreter
-//   with the specified string as an error message
+// PyStrObj_UpdateString - pystrs are made from the string rep and keep
+//   it, but if something threw it away, make it again from the str
 //
-static int
-PyReturnTclError(Tcl_Interp *interp, char *string)
+static void
+PyStrObj_UpdateString(Tcl_Obj *obj)
 {
-    Tcl_SetObjResult(interp, Tcl_NewStringObj(string, -1));
-    return TCL_ERROR;
+    PyGILState_STATE gilState = PyGILState_Ensure();
+    Tcl_Obj *stringObj = tohil_PyUnicodeToTcl((PyObject *)obj->internalRep.twoPtrValue.ptr1);
+    if (stringObj == NULL) {
+        PyErr_Clear();
+        stringObj = Tcl_NewObj();
+    }
+    Tcl_IncrRefCount(stringObj);
+
+    int length;
+    const char *string = Tcl_GetStringFromObj(stringObj, &length);
+    obj->bytes = ckalloc(length + 1);
+    memcpy(obj->bytes, string, length + 1);
+    obj->length = length;
+    Tcl_DecrRefCount(stringObj);
+    PyGILState_Release(gilState);
 }
 
 //
-// PyReturnException - return a python exception to tcl as a tcl error
 //
-static int
-PyReturnException(Tcl_Interp *interp, char *description)
+// end of tcl "pystr" object type
+//
+//
+
+//
+// tohil_TclObjToPyString - make a python str from a tcl object's string rep
+//
+static PyObject *
+tohil_TclObjToPyString(Tcl_Obj *obj)
 {
-    // Shouldn't call this function unless Python has excepted
-    if (PyErr_Occurred() == NULL) {
-        return PyReturnTclError(interp, "bug in tohil - PyReturnException called without a python error having occurred");
+    if (obj->typePtr == &pyStrObjType) {
+        PyObject *pStr = (PyObject *)obj->internalRep.twoPtrValue.ptr1;
+        Py_INCREF(pStr);
+        return pStr;
     }
 
-    // break out the exception
-    PyObject *pType = NULL, *pVal = NULL, *pTrace = NULL;
+    int tclStringSize;
+    const char *tclString = Tcl_GetStringFromObj(obj, &tclStringSize);
+    PyObject *pStr = tohil_TclStringToPy(tclString, tclStringSize);
 
-    PyErr_Fetch(&pType, &pVal, &pTrace); /* Clears exception */
-    PyErr_NormalizeException(&pType, &pVal, &pTrace);
+    // remember the str in pure strings, if asked to
+    if (pyStrCacheEnabled && pStr != NULL && obj->typePtr == NULL) {
+        Py_INCREF(pStr);
+        obj->internalRep.twoPtrValue.ptr1 = pStr;
+        obj->typePtr = &pyStrObjType;
+    }
+    return pStr;
+}
 
-    // set tcl interpreter result
-    Tcl_SetObjResult(interp, pyObjToTcl(interp, pVal));
+//
+// tohil_PyUnicodeToTcl - make a tcl string object from a python str
+//
+// python caches the utf-8 of a str, or for ascii simply has it, and it is
+// nearly always exactly what tcl wants, so it is copied once, into the
+// new object.  tcl needs NUL as C0 80 and 8.6 has its own ideas about
+// characters beyond the BMP, so strings with either of those go through
+// tcl's utf-8 decoder as before.
+//
+static Tcl_Obj *
+tohil_PyUnicodeToTcl(PyObject *pStr)
+{
+    Py_ssize_t utf8len;
+    const char *utf8 = PyUnicode_AsUTF8AndSize(pStr, &utf8len);
+    if (utf8 == NULL) {
+        return NULL;
+    }
 
-    // invoke python tohil.handle_exception(type, val, tracebackObject)
-    // it returns a tuple consisting of the error code and error info (traceback)
-    PyObject *pExceptionResult = PyObject_CallFunctionObjArgs(pTohilHandleException, pType, pVal, pTrace, NULL);
+    if (utf8len > INT_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "string is too long for tcl");
+        return NULL;
+    }
 
-    // call tohil python exception handler function
-    // return to me a tuple containing the error string, error code, and traceback
-    if (pExceptionResult == NULL) {
-        // NB debug break out the exception
-        PyObject *pType = NULL, *pVal = NULL, *pTrace = NULL;
-        PyErr_Fetch(&pType, &pVal, &pTrace); /* Clears exception */
-        PyErr_NormalizeException(&pType, &pVal, &pTrace);
-        PyObject_Print(pType, stdout, 0);
-        PyObject_Print(pVal, stdout, 0);
-        return PyReturnTclError(interp, "some problem running the tohil python exception handler");
+#ifndef PYPY_VERSION
+    // only strings with characters beyond the BMP are stored four bytes
+    // to a character, so the kind says whether there are any
+    int simple = (PyUnicode_KIND(pStr) != PyUnicode_4BYTE_KIND && memchr(utf8, '\0', utf8len) == NULL);
+#else
+    int simple = 1;
+    for (Py_ssize_t i = 0; i < utf8len; i++) {
+        unsigned char c = (unsigned char)utf8[i];
+        if (c == '\0' || c >= 0xf0) {
+            simple = 0;
+            break;
+        }
+    }
+#endif
+    if (simple) {
+        return Tcl_NewStringObj(utf8, (int)utf8len);
     }
 
-    if (!PyTuple_Check(pExceptionResult) || PyTuple_GET_SIZE(pExceptionResult) != 2) {
-        return PyReturnTclError(interp, "malfunction in tohil python exception handler, did not return tuple or tuple did not contain 2 elements");
+    char *tclString;
+    int tclStringLen;
+    if (tohil_UTF8toTcl((char *)utf8, (int)utf8len, &tclString, &tclStringLen) != TCL_OK) {
+        PyErr_SetString(PyExc_RuntimeError, "unable to convert python string to tcl");
+        return NULL;
+    }
+    Tcl_Obj *tObj = Tcl_NewStringObj(tclString, tclStringLen);
+    ckfree(tclString);
+    return tObj;
+}
+
+//
+// turn a tcl bignum into a python int.  the digits travel in hex, which
+// unlike decimal is linear time to produce and to parse.
+//
+static PyObject *
+tohil_BignumToPyLong(mp_int *big)
+{
+#if defined(MP_DIGIT_BIT) && (MP_DIGIT_BIT % 4) == 0
+    // when tommath digits are a whole number of hex digits, which they
+    // are in tcl, the hex can be written straight out of them
+    static const char hexDigits[] = "0123456789abcdef";
+    const int hexPerDigit = MP_DIGIT_BIT / 4;
+    char *digits = ckalloc(big->used * hexPerDigit + 3);
+    char *p = digits;
+
+    if (big->sign == MP_NEG) {
+        *p++ = '-';
+    }
+    *p++ = '0';
+    for (int i = big->used - 1; i >= 0; i--) {
+        mp_digit d = big->dp[i];
+        for (int shift = MP_DIGIT_BIT - 4; shift >= 0; shift -= 4) {
+            *p++ = hexDigits[(d >> shift) & 0xf];
+        }
     }
+    *p = '\0';
+#else
+    int size;
 
-    Tcl_SetObjErrorCode(interp, pyObjToTcl(interp, PyTuple_GET_ITEM(pExceptionResult, 0)));
-    Tcl_AppendObjToErrorInfo(interp, pyObjToTcl(interp, PyTuple_GET_ITEM(pExceptionResult, 1)));
-    Py_DECREF(pExceptionResult);
-    return TCL_ERROR;
+    if (mp_radix_size(big, 16, &size) != MP_OKAY) {
+        return PyErr_NoMemory();
+    }
+
+    char *digits = ckalloc(size);
+    if (mp_toradix_n(big, digits, 16, size) != MP_OKAY) {
+        ckfree(digits);
+        return PyErr_NoMemory();
+    }
+#endif
+    PyObject *pLong = PyLong_FromString(digits, NULL, 16);
+    ckfree(digits);
+    return pLong;
 }
 
 //
-// call python from tcl with very explicit arguments versus
-//   slamming stuff through eval
+// tohil_TclObjToPyLong - turn a tcl integer of any size into a python int.
 //
-static int
-TohilCall_Cmd(ClientData clientData, /* Not used. */
-              Tcl_Interp *interp,    /* Current interpreter */
-              int objc,              /* Number of arguments */
-              Tcl_Obj *const objv[]  /* Argument strings */
-)
+// returns NULL if there's an error.  if it was tcl that failed, because
+// obj isn't an integer, no python exception is set and the tcl error is
+// in the interpreter result, for the caller to raise however it likes.
+//
+static PyObject *
+tohil_TclObjToPyLong(Tcl_Interp *interp, Tcl_Obj *obj)
 {
-    if (objc < 2) {
-    wrongargs:
-        Tcl_WrongNumArgs(interp, 1, objv, "?-kwlist list? func ?arg ...?");
-        return TCL_ERROR;
+    Tcl_WideInt wideValue;
+    mp_int big;
+
+    if (obj->typePtr != tclBignumType && Tcl_GetWideIntFromObj(NULL, obj, &wideValue) == TCL_OK) {
+        return PyLong_FromLongLong(wideValue);
     }
 
-    PyObject *kwObj = NULL;
-    Tcl_DString ds;
-    const char *objandfn = tohil_TclObjToUTF8(objv[1], &ds);
-    int objStart = 2;
+    if (Tcl_GetBignumFromObj(interp, obj, &big) != TCL_OK) {
+        return NULL;
+    }
+    PyObject *pLong = tohil_BignumToPyLong(&big);
+    mp_clear(&big);
+    return pLong;
+}
 
-    if (*objandfn == '-' && STREQU(objandfn, "-kwlist")) {
-        if (objc < 4)
-            goto wrongargs;
-        kwObj = tclListObjToPyDictObject(interp, objv[2]);
-        Tcl_DStringFree(&ds);
-        objandfn = tohil_TclObjToUTF8(objv[3], &ds);
-        objStart = 4;
-        if (kwObj == NULL) {
-            return TCL_ERROR;
+//
+// tohil_PyLongToTclObj - turn a python int into a tcl integer, a wide int
+//   if it fits or a bignum if it doesn't
+//
+static Tcl_Obj *
+tohil_PyLongToTclObj(PyObject *pObj)
+{
+    int overflow;
+    long long value = PyLong_AsLongLongAndOverflow(pObj, &overflow);
+
+    if (!overflow) {
+        if (value == -1 && PyErr_Occurred()) {
+            return NULL;
         }
+        return Tcl_NewWideIntObj((Tcl_WideInt)value);
     }
 
-    /* Borrowed ref, do not decrement */
-    PyObject *pMainModule = PyImport_AddModule("__main__");
-    if (pMainModule == NULL) {
-        Tcl_DStringFree(&ds);
-        return PyReturnException(interp, "unable to add module __main__ to python interpreter");
+    // too big for a wide int, so it's a bignum.  as above, go through hex
+    // rather than decimal where we can.
+#ifndef PYPY_VERSION
+    PyObject *pDigits = PyNumber_ToBase(pObj, 16);
+    int radix = 16;
+#else
+    PyObject *pDigits = PyObject_Str(pObj);
+    int radix = 10;
+#endif
+    if (pDigits == NULL) {
+        return NULL;
+    }
+    const char *digits = PyUnicode_AsUTF8(pDigits);
+    if (digits == NULL) {
+        Py_DECREF(pDigits);
+        return NULL;
     }
 
-    /* So we don't have to special case the decref in the following loop */
-    Py_INCREF(pMainModule);
-    PyObject *pObjParent = NULL;
-    PyObject *pObj = pMainModule;
-    PyObject *pObjStr = NULL;
-    char *dot = index(objandfn, '.');
-    while (dot != NULL) {
-        pObjParent = pObj;
-
-        pObjStr = PyUnicode_FromStringAndSize(objandfn, dot - objandfn);
-        if (pObjStr == NULL) {
-            Py_DECREF(pObjParent);
-            Tcl_DStringFree(&ds);
-            return PyReturnException(interp, "failed unicode translation of call function in python interpreter");
-        }
+    int negative = (*digits == '-');
+    if (negative) {
+        digits++;
+    }
+    if (radix == 16) {
+        // skip the 0x
+        digits += 2;
+    }
 
-        pObj = PyObject_GetAttr(pObjParent, pObjStr);
-        Py_DECREF(pObjStr);
-        Py_DECREF(pObjParent);
-        if (pObj == NULL) {
-            Tcl_DStringFree(&ds);
-            return PyReturnException(interp, "failed to find dotted attribute in python interpreter");
+    mp_int big;
+#if defined(MP_DIGIT_BIT) && (MP_DIGIT_BIT % 4) == 0 && !defined(PYPY_VERSION)
+    // pack the hex digits straight into the tommath digits
+    const int hexPerDigit = MP_DIGIT_BIT / 4;
+    const char *end = digits + strlen(digits);
+    int nDigits = (int)((end - digits + hexPerDigit - 1) / hexPerDigit);
+
+    if (mp_init_size(&big, nDigits) != MP_OKAY) {
+        Py_DECREF(pDigits);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    for (int i = 0; i < nDigits; i++) {
+        const char *start = (end - digits > hexPerDigit) ? end - hexPerDigit : digits;
+        mp_digit d = 0;
+        for (const char *p = start; p < end; p++) {
+            d = (d << 4) | (mp_digit)((*p <= '9') ? *p - '0' : *p - 'a' + 10);
         }
+        big.dp[i] = d;
+        end = start;
+    }
+    big.used = nDigits;
+    big.sign = negative ? MP_NEG : MP_ZPOS;
+    mp_clamp(&big);
+#else
+    if (mp_init(&big) != MP_OKAY) {
+        Py_DECREF(pDigits);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    if (mp_read_radix(&big, digits, radix) != MP_OKAY || (negative && mp_neg(&big, &big) != MP_OKAY)) {
+        mp_clear(&big);
+        Py_DECREF(pDigits);
+        PyErr_NoMemory();
+        return NULL;
+    }
+#endif
+    Py_DECREF(pDigits);
+
+    // Tcl_NewBignumObj takes over big's digits and clears it
+    return Tcl_NewBignumObj(&big);
+}
+
+//
+// turn a tcl object into a python object according to what the tcl object
+// already is, as told by its internal rep.  ints and doubles come back
+// as python ints and floats, lists and dicts are converted recursively,
+// byte arrays become bytes and everything else is a string.
+//
+// this only ever reads internal reps that are already there, so nothing
+// is parsed and nothing shimmers.  an object that has never been used
+// as a number or list comes back as a string, even if it looks like one.
+//
+static PyObject *
+tclObjToPyAuto(Tcl_Interp *interp, Tcl_Obj *tObj)
+{
+    const Tcl_ObjType *typePtr = tObj->typePtr;
 
-        objandfn = dot + 1;
-        dot = index(objandfn, '.');
+    if (typePtr == NULL) {
+        goto string;
     }
 
-    PyObject *pFn = PyObject_GetAttrString(pObj, objandfn);
-    Py_DECREF(pObj);
-    Tcl_DStringFree(&ds);
-    if (pFn == NULL)
-        return PyReturnException(interp, "failed to find object/function in python interpreter");
+    if (typePtr == &pyObjectObjType) {
+        return tohil_PyObjectObjGet(tObj);
+    }
 
-    if (!PyCallable_Check(pFn)) {
-        Py_DECREF(pFn);
-        return PyReturnException(interp, "function is not callable");
+    if (typePtr == &pyBufferObjType) {
+        return tohil_PyBufferObjGet(tObj);
     }
 
-    // if there are no positional arguments, we will
-    // call PyTuple_New with a 0 argument, producing
-    // a 0-length tuple.  whil PyObject_Call's kwargs
-    // argument can be NULL, args must not; an empty
-    // tuple should be used
-    int i;
-    PyObject *pArgs = PyTuple_New(objc - objStart);
-    PyObject *curarg = NULL;
-    for (i = objStart; i < objc; i++) {
-        curarg = PyUnicode_FromString(tohil_TclObjToUTF8(objv[i], &ds));
-        Tcl_DStringFree(&ds);
-        if (curarg == NULL) {
-            Py_DECREF(pArgs);
-            Py_DECREF(pFn);
-            return PyReturnException(interp, "unicode string conversion failed");
+    if (typePtr == tclIntType || typePtr == tclBignumType || (typePtr == tclWideIntType && tclWideIntType != NULL)) {
+        PyObject *pLong = tohil_TclObjToPyLong(NULL, tObj);
+        if (pLong == NULL && !PyErr_Occurred()) {
+            goto string;
         }
-        /* Steals a reference */
-        PyTuple_SET_ITEM(pArgs, i - objStart, curarg);
+        return pLong;
     }
 
-    PyObject *pRet = PyObject_Call(pFn, pArgs, kwObj);
-    Py_DECREF(pFn);
-    Py_DECREF(pArgs);
-    if (kwObj != NULL)
-        Py_DECREF(kwObj);
-    if (pRet == NULL)
-        return PyReturnException(interp, "error in python object call");
-
-    Tcl_Obj *tRet = pyObjToTcl(interp, pRet);
-    Py_DECREF(pRet);
-    if (tRet == NULL)
-        return PyReturnException(interp, "error converting python object to tcl object");
+    if (typePtr == tclDoubleType) {
+        return PyFloat_FromDouble(tObj->internalRep.doubleValue);
+    }
 
-    Tcl_SetObjResult(interp, tRet);
-    return TCL_OK;
-}
+    if (typePtr == tclListType) {
+        Tcl_Obj **list;
+        int count;
 
-//
-// implements tcl command tohil::import, to import a python module
-//   into the python interpreter.
-//
-static int
-TohilImport_Cmd(ClientData clientData, /* Not used. */
-                Tcl_Interp *interp,    /* Current interpreter */
-                int objc,              /* Number of arguments */
-                Tcl_Obj *const objv[]  /* Argument strings */
-)
-{
-    const char *modname, *topmodname;
-    PyObject *pMainModule, *pTopModule;
-    int ret = -1;
+        if (Tcl_ListObjGetElements(NULL, tObj, &count, &list) != TCL_OK) {
+            goto string;
+        }
 
-    if (objc != 2) {
-        Tcl_WrongNumArgs(interp, 1, objv, "module");
-        return TCL_ERROR;
+        PyObject *plist = PyList_New(count);
+        if (plist == NULL) {
+            return NULL;
+        }
+        for (int i = 0; i < count; i++) {
+            PyObject *pElement = tclObjToPyAuto(interp, list[i]);
+            if (pElement == NULL) {
+                Py_DECREF(plist);
+                return NULL;
+            }
+            PyList_SET_ITEM(plist, i, pElement);
+        }
+        return plist;
     }
 
-    modname = Tcl_GetString(objv[1]);
-
-    /* Borrowed ref, do not decrement */
-    pMainModule = PyImport_AddModule("__main__");
-    if (pMainModule == NULL)
-        return PyReturnException(interp, "add module __main__ failed");
+    if (typePtr == tclDictType) {
+        Tcl_DictSearch search;
+        Tcl_Obj *keyObj, *valueObj;
+        int done;
 
-    pTopModule = PyImport_ImportModule(modname);
-    if (pTopModule == NULL)
-        return PyReturnException(interp, "import module failed");
+        if (Tcl_DictObjFirst(NULL, tObj, &search, &keyObj, &valueObj, &done) != TCL_OK) {
+            goto string;
+        }
 
-    topmodname = PyModule_GetName(pTopModule);
-    if (topmodname != NULL) {
-        ret = PyObject_SetAttrString(pMainModule, topmodname, pTopModule);
+        PyObject *pdict = PyDict_New();
+        if (pdict == NULL) {
+            Tcl_DictObjDone(&search);
+            return NULL;
+        }
+        for (; !done; Tcl_DictObjNext(&search, &keyObj, &valueObj, &done)) {
+            // python dict keys have to be hashable, so keys that are
+            // lists or dicts in tcl are used as strings
+            PyObject *pKey;
+            if (keyObj->typePtr == tclListType || keyObj->typePtr == tclDictType) {
+                int keyLength;
+                char *key = Tcl_GetStringFromObj(keyObj, &keyLength);
+                Tcl_Obj *keyStringObj = Tcl_NewStringObj(key, keyLength);
+                Tcl_IncrRefCount(keyStringObj);
+                pKey = tclObjToPyAuto(interp, keyStringObj);
+                Tcl_DecrRefCount(keyStringObj);
+            } else {
+                pKey = tclObjToPyAuto(interp, keyObj);
+            }
+            PyObject *pValue = (pKey == NULL) ? NULL : tclObjToPyAuto(interp, valueObj);
+            if (pValue == NULL || PyDict_SetItem(pdict, pKey, pValue) < 0) {
+                Py_XDECREF(pKey);
+                Py_XDECREF(pValue);
+                Py_DECREF(pdict);
+                Tcl_DictObjDone(&search);
+                return NULL;
+            }
+            Py_DECREF(pKey);
+            Py_DECREF(pValue);
+        }
+        Tcl_DictObjDone(&search);
+        return pdict;
     }
-    Py_DECREF(pTopModule);
 
-    if (ret < 0)
-        return PyReturnException(interp, "while trying to import a module");
+    if (typePtr == tclByteArrayType) {
+        int size;
+        unsigned char *byteArray = Tcl_GetByteArrayFromObj(tObj, &size);
+        return PyBytes_FromStringAndSize((const char *)byteArray, size);
+    }
 
-    return TCL_OK;
+string:
+    return tohil_TclObjToPyString(tObj);
 }
 
-static int
-TohilEval_Cmd(ClientData clientData, /* Not used. */
-              Tcl_Interp *interp,    /* Current interpreter */
-              int objc,              /* Number of arguments */
-              Tcl_Obj *const objv[]  /* Argument strings */
-)
+//
+// tohil_PySequenceToTclList - convert a list or tuple to a tcl list.
+//
+// Tcl_NewListObj with a NULL objv makes an empty list with room for
+// objc elements, so the elements are appended without the list ever
+// having to grow.
+//
+static Tcl_Obj *
+tohil_PySequenceToTclList(Tcl_Interp *interp, PyObject *pSeq)
 {
-    if (objc != 2) {
-        Tcl_WrongNumArgs(interp, 1, objv, "evalString");
-        return TCL_ERROR;
-    }
-    Tcl_DString ds;
-    const char *cmd = tohil_TclObjToUTF8(objv[1], &ds);
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(pSeq);
 
-    // PyCompilerFlags flags = _PyCompilerFlags_INIT;
-    // PyObject *code = Py_CompileStringExFlags(cmd, "tohil", Py_eval_input, &flags, -1);
-    PyObject *code = Py_CompileStringFlags(cmd, "tohil", Py_eval_input, NULL);
-    Tcl_DStringFree(&ds);
-
-    if (code == NULL) {
-        return PyReturnException(interp, "while compiling python eval code");
+    if (n > TOHIL_LIST_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "sequence is too long for a tcl list");
+        return NULL;
     }
 
-    PyObject *main_module = PyImport_AddModule("__main__");
-    PyObject *global_dict = PyModule_GetDict(main_module);
-    PyObject *pyobj = PyEval_EvalCode(code, global_dict, global_dict);
-
-    Py_XDECREF(code);
+    Tcl_Obj *tObj = Tcl_NewListObj((int)n, NULL);
 
-    if (pyobj == NULL) {
-        return PyReturnException(interp, "while evaluating python code");
+    // converting an element can run python code, which could change the
+    // size of a list out from under us, so check as we go
+    for (Py_ssize_t i = 0; i < n && i < PySequence_Fast_GET_SIZE(pSeq); i++) {
+        PyObject *pItem = PySequence_Fast_GET_ITEM(pSeq, i);
+        Py_INCREF(pItem);
+        Tcl_Obj *tItem = _pyObjToTcl(interp, pItem);
+        Py_DECREF(pItem);
+        if (tItem == NULL) {
+            Tcl_IncrRefCount(tObj);
+            Tcl_DecrRefCount(tObj);
+            return NULL;
+        }
+        Tcl_ListObjAppendElement(NULL, tObj, tItem);
     }
 
-    Tcl_SetObjResult(interp, pyObjToTcl(interp, pyobj));
-    Py_XDECREF(pyobj);
-    return TCL_OK;
+    return tObj;
 }
 
-// awfully similar to TohilEval_Cmd above
-// but expecting to do more like capture stdout
-static int
-TohilExec_Cmd(ClientData clientData, /* Not used. */
-              Tcl_Interp *interp,    /* Current interpreter */
-              int objc,              /* Number of arguments */
-              Tcl_Obj *const objv[]  /* Argument strings */
-)
+//
+// tohil_PyIterableToTclList - convert a set, generator or other iterable
+//   to a tcl list, with room made up front for as many elements as the
+//   iterable's length hint says, up to TOHIL_LENGTH_HINT_MAX.  past
+//   that the list grows as elements are appended, since a hint is only
+//   advisory.
+//
+static Tcl_Obj *
+tohil_PyIterableToTclList(Tcl_Interp *interp, PyObject *pObj)
 {
-    if (objc != 2) {
-        Tcl_WrongNumArgs(interp, 1, objv, "execString");
-        return TCL_ERROR;
-    }
-    Tcl_DString ds;
-    const char *cmd = tohil_TclObjToUTF8(objv[1], &ds);
-
-    PyObject *code = Py_CompileStringFlags(cmd, "tohil", Py_file_input, NULL);
-    Tcl_DStringFree(&ds);
+    PyObject *pItem;
 
-    if (code == NULL) {
-        return PyReturnException(interp, "while compiling python exec code");
+    Py_ssize_t hint = PyObject_LengthHint(pObj, 0);
+    if (hint < 0) {
+        return NULL;
     }
 
-    PyObject *main_module = PyImport_AddModule("__main__");
-    PyObject *global_dict = PyModule_GetDict(main_module);
-    PyObject *pyobj = PyEval_EvalCode(code, global_dict, global_dict);
+    PyObject *pIter = PyObject_GetIter(pObj);
+    if (pIter == NULL) {
+        return NULL;
+    }
 
-    Py_XDECREF(code);
+    Tcl_Obj *tObj = Tcl_NewListObj((hint > TOHIL_LENGTH_HINT_MAX) ? TOHIL_LENGTH_HINT_MAX : (int)hint, NULL);
+    Tcl_Obj *tItem = tObj;
 
-    if (pyobj == NULL) {
-        return PyReturnException(interp, "while evaluating python code");
+    while ((pItem = PyIter_Next(pIter)) != NULL) {
+        tItem = _pyObjToTcl(interp, pItem);
+        Py_DECREF(pItem);
+        if (tItem == NULL) {
+            break;
+        }
+        Tcl_ListObjAppendElement(NULL, tObj, tItem);
     }
+    Py_DECREF(pIter);
 
-    Tcl_SetObjResult(interp, pyObjToTcl(interp, pyobj));
-    Py_XDECREF(pyobj);
-    return TCL_OK;
+    if (tItem == NULL || PyErr_Occurred()) {
+        Tcl_IncrRefCount(tObj);
+        Tcl_DecrRefCount(tObj);
+        return NULL;
+    }
+    return tObj;
 }
 
 //
-// implements tcl-side tohil::interact command to launch the python
-//   interpreter's interactive loop
+// tohil_BufferKind - say what kind of numbers the items of a buffer are,
+//   from its struct module format: 'i' for signed and 'u' for unsigned
+//   integers, '?' for bools and 'f' or 'd' for floats and doubles.
+//   return 0 for anything else, including byte orders other than our own,
+//   and for formats describing more than one number.
 //
-static int
-TohilInteract_Cmd(ClientData clientData, /* Not used. */
-                  Tcl_Interp *interp,    /* Current interpreter */
-                  int objc,              /* Number of arguments */
-                  Tcl_Obj *const objv[]  /* Argument strings */
-)
+static char
+tohil_BufferKind(Py_buffer *view)
 {
-    if (objc != 1) {
-        Tcl_WrongNumArgs(interp, 1, objv, "");
-        return TCL_ERROR;
-    }
+    const char *format = (view->format == NULL) ? "B" : view->format;
 
-#ifndef PYPY_VERSION
-    int result = PyRun_InteractiveLoop(stdin, "stdin");
-    if (result < 0) {
-        return PyReturnException(interp, "interactive loop failure");
+    if (*format == '@' || *format == '=' || *format == (PY_LITTLE_ENDIAN ? '<' : '>')) {
+        format++;
+    }
+    if (format[0] == '\0' || format[1] != '\0') {
+        return 0;
     }
-#else
-    return PyReturnException(interp, "interactive loop not supported with pypy");
-#endif
 
-    return TCL_OK;
+    switch (format[0]) {
+    case 'b':
+    case 'h':
+    case 'i':
+    case 'l':
+    case 'q':
+    case 'n':
+        return (view->itemsize == 1 || view->itemsize == 2 || view->itemsize == 4 || view->itemsize == 8) ? 'i' : 0;
+    case 'B':
+    case 'H':
+    case 'I':
+    case 'L':
+    case 'Q':
+    case 'N':
+        return (view->itemsize == 1 || view->itemsize == 2 || view->itemsize == 4 || view->itemsize == 8) ? 'u' : 0;
+    case '?':
+        return (view->itemsize == 1) ? '?' : 0;
+    case 'f':
+        return (view->itemsize == sizeof(float)) ? 'f' : 0;
+    case 'd':
+        return (view->itemsize == sizeof(double)) ? 'd' : 0;
+    }
+    return 0;
 }
 
-/* Python library begins here */
-
 //
+// tohil_BufferItemToTcl - make a tcl number from the buffer item at p
 //
-// python tcl object "tclobj"
-//
-//
-
-//
-// return true if python object is a tclobj type
-//
-int
-TohilTclObj_Check(PyObject *pyObj)
+static Tcl_Obj *
+tohil_BufferItemToTcl(const char *p, char kind, Py_ssize_t itemsize)
 {
-    return PyObject_TypeCheck(pyObj, &TohilTclObjType);
+    switch (kind) {
+    case 'i': {
+        int8_t i8;
+        int16_t i16;
+        int32_t i32;
+        int64_t i64;
+        switch (itemsize) {
+        case 1:
+            memcpy(&i8, p, 1);
+            return Tcl_NewWideIntObj(i8);
+        case 2:
+            memcpy(&i16, p, 2);
+            return Tcl_NewWideIntObj(i16);
+        case 4:
+            memcpy(&i32, p, 4);
+            return Tcl_NewWideIntObj(i32);
+        default:
+            memcpy(&i64, p, 8);
+            return Tcl_NewWideIntObj(i64);
+        }
+    }
+    case 'u': {
+        uint8_t u8;
+        uint16_t u16;
+        uint32_t u32;
+        uint64_t u64;
+        switch (itemsize) {
+        case 1:
+            memcpy(&u8, p, 1);
+            return Tcl_NewWideIntObj(u8);
+        case 2:
+            memcpy(&u16, p, 2);
+            return Tcl_NewWideIntObj(u16);
+        case 4:
+            memcpy(&u32, p, 4);
+            return Tcl_NewWideIntObj(u32);
+        default:
+            memcpy(&u64, p, 8);
+            if (u64 <= INT64_MAX) {
+                return Tcl_NewWideIntObj((Tcl_WideInt)u64);
+            }
+            // too big for a wide int, tcl makes a bignum from the string
+            char digits[24];
+            snprintf(digits, sizeof(digits), "%llu", (unsigned long long)u64);
+            return Tcl_NewStringObj(digits, -1);
+        }
+    }
+    case '?':
+        return Tcl_NewBooleanObj(*p != 0);
+    case 'f': {
+        float f;
+        memcpy(&f, p, sizeof(f));
+        return Tcl_NewDoubleObj(f);
+    }
+    default: {
+        double d;
+        memcpy(&d, p, sizeof(d));
+        return Tcl_NewDoubleObj(d);
+    }
+    }
 }
 
 //
-// create a new python tclobj object from a tclobj
+// tohil_AttemptAlloc - allocate size bytes, which may be more than the
+//   unsigned int tcl takes, setting a MemoryError and returning NULL
+//   rather than panicking if it can't be done
 //
-static PyObject *
-TohilTclObj_FromTclObj(Tcl_Obj *obj)
+static char *
+tohil_AttemptAlloc(size_t size)
 {
-    TohilTclObj *self = (TohilTclObj *)TohilTclObjType.tp_alloc(&TohilTclObjType, 0);
-    if (self != NULL) {
-        self->interp = tcl_interp;
-        self->tclobj = obj;
-        self->to = NULL;
-        Tcl_IncrRefCount(obj);
+    char *p = (size <= UINT_MAX) ? attemptckalloc((unsigned int)size) : NULL;
+    if (p == NULL) {
+        PyErr_NoMemory();
     }
-    return (PyObject *)self;
+    return p;
 }
 
 //
-// create a new python tclobj object
-//
-// creates an empty object if no argument is given, but if an
-// argument is provided, performs pyObjToTcl conversion on it
-// and makes the new tclobj object point to that
+// tohil_BufferToTclList - make a tcl list of the numbers in dimension dim
+//   of a C-contiguous buffer, starting at *pp and advancing it past them.
+//   dimensions after the last are lists of lists.
 //
-static PyObject *
-TohilTclObj_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+static Tcl_Obj *
+tohil_BufferToTclList(Py_buffer *view, char kind, int dim, const char **pp)
 {
-    PyObject *pSource = NULL;
-    PyObject *toType = NULL;
-    static char *kwlist[] = {"from", "to", NULL};
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O$O", kwlist, &pSource, &toType)) {
+    Py_ssize_t count = (view->shape == NULL) ? view->len / view->itemsize : view->shape[dim];
+    if (count > TOHIL_LIST_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "buffer is too long for a tcl list");
         return NULL;
     }
 
-    if (toType != NULL) {
-        if (!PyType_Check(toType)) {
-            PyErr_SetString(PyExc_RuntimeError, "to type is not a valid python data type");
-            return NULL;
-        }
+    Tcl_Obj **objv = (Tcl_Obj **)tohil_AttemptAlloc(sizeof(Tcl_Obj *) * (count ? count : 1));
+    if (objv == NULL) {
+        return NULL;
     }
-
-    TohilTclObj *self = (TohilTclObj *)type->tp_alloc(type, 0);
-    if (self != NULL) {
-        self->interp = tcl_interp;
-        if (pSource == NULL) {
-            if (STREQU(type->tp_name, "tohil.tcldict")) {
-                self->tclobj = Tcl_NewDictObj();
-            } else {
-                self->tclobj = Tcl_NewObj();
+    for (Py_ssize_t i = 0; i < count; i++) {
+        if (dim + 1 < view->ndim) {
+            objv[i] = tohil_BufferToTclList(view, kind, dim + 1, pp);
+            if (objv[i] == NULL) {
+                for (Py_ssize_t j = 0; j < i; j++) {
+                    Tcl_IncrRefCount(objv[j]);
+                    Tcl_DecrRefCount(objv[j]);
+                }
+                ckfree((char *)objv);
+                return NULL;
             }
         } else {
-            self->tclobj = pyObjToTcl(self->interp, pSource);
+            objv[i] = tohil_BufferItemToTcl(*pp, kind, view->itemsize);
+            *pp += view->itemsize;
         }
-        Tcl_IncrRefCount(self->tclobj);
-        self->to = (PyTypeObject *)toType;
-        Py_XINCREF(toType);
     }
-    return (PyObject *)self;
+    Tcl_Obj *listObj = Tcl_NewListObj((int)count, objv);
+    ckfree((char *)objv);
+    return listObj;
 }
 
 //
-// deallocate function for python tclobj type
+// tohil_BufferToTcl - make a tcl list of numbers, or a number for a
+//   buffer of no dimensions, from a C-contiguous buffer of kind items
 //
-static void
-TohilTclObj_dealloc(TohilTclObj *self)
+static Tcl_Obj *
+tohil_BufferToTcl(Py_buffer *view, char kind)
 {
-    Tcl_DecrRefCount(self->tclobj);
-    Py_XDECREF(self->to);
-    Py_TYPE(self)->tp_free((PyObject *)self);
+    const char *p = (const char *)view->buf;
+
+    if (view->ndim == 0) {
+        return tohil_BufferItemToTcl(p, kind, view->itemsize);
+    }
+    return tohil_BufferToTclList(view, kind, 0, &p);
 }
 
 //
-// init function for python tclobj type
+// tohil_PyBufferToTcl - if pObj exports a contiguous buffer of bytes,
+//   like a bytearray, memoryview or mmap does, set *objPtr to a tcl byte
+//   array with a copy of them and return 1.  if the buffer holds numbers,
+//   like an array.array or a numpy array does, set it to a tcl list of
+//   them, read straight from the buffer, and return 1.  return 0, with no
+//   python error, for anything else, which converts some other way.
+//   return -1 with a python error if the conversion failed.
 //
 static int
-TohilTclObj_init(TohilTclObj *self, PyObject *args, PyObject *kwds)
+tohil_PyBufferToTcl(PyObject *pObj, Tcl_Obj **objPtr)
 {
-    return 0;
-}
+    Py_buffer view;
 
-//
-// str() method for python tclobj type
-//
-static PyObject *
-TohilTclObj_str(TohilTclObj *self)
-{
-    int tclStringSize;
-    char *tclString = Tcl_GetStringFromObj(self->tclobj, &tclStringSize);
+    if (PyObject_GetBuffer(pObj, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+        PyErr_Clear();
+        return 0;
+    }
+
+    int result = 1;
+    char kind;
+    // signed bytes are small numbers, like array('b') has, not bytes
+    if (view.itemsize == 1 && view.len <= INT_MAX && (view.format == NULL || strcmp(view.format, "B") == 0 || strcmp(view.format, "c") == 0)) {
+        *objPtr = Tcl_NewByteArrayObj((const unsigned char *)view.buf, (int)view.len);
+    } else if ((kind = tohil_BufferKind(&view)) != 0) {
+        *objPtr = tohil_BufferToTcl(&view, kind);
+        if (*objPtr == NULL) {
+            result = -1;
+        }
+    } else {
+        result = 0;
+    }
+    PyBuffer_Release(&view);
+    return result;
+}
+
+//
+// convert a python object to a tcl object - amazing code by aidan
+//
+static Tcl_Obj *
+_pyObjToTcl(Tcl_Interp *interp, PyObject *pObj)
+{
+    Tcl_Obj *tObj;
+    PyObject *pStrObj;
+
+    Py_ssize_t i, len;
+    PyObject *pVal = NULL;
+    Tcl_Obj *tVal;
+
+    PyObject *pItems = NULL;
+    PyObject *pItem = NULL;
+    PyObject *pKey = NULL;
+    Tcl_Obj *tKey;
+
+    /*
+     * The ordering must always be more 'specific' types first. E.g. a
+     * string also obeys the sequence protocol...but we probably want it
+     * to be a string rather than a list. Suggested order below:
+     * - None -> {}
+     * - True -> 1, False -> 0
+     * - tclobj -> tclobj
+     * - tcldict -> tcldict
+     * - bytes -> tcl byte string
+     * - bytearray, memoryview, mmap, other byte buffers -> tcl byte string
+     * - array.array, numpy arrays, other number buffers -> tcl list
+     * - unicode -> tcl unicode string
+     * - int -> tcl wide int or bignum
+     * - float -> tcl double
+     * - number protocol -> tcl number
+     * - list, tuple -> tcl list
+     * - dict -> tcl dict
+     * - sequence protocol -> tcl list
+     * - mapping protocol -> tcl dict
+     * - set, frozenset, generator, other non-iterator iterables -> tcl list
+     * - other -> error (currently converts to string)
+     *
+     * Note that the sequence and mapping protocol are both determined by __getitem__,
+     * the only difference is that dict subclasses are excluded from sequence.
+     */
+
+    if (pObj == Py_None) {
+        tObj = Tcl_NewObj();
+    } else if (pObj == Py_True || pObj == Py_False) {
+        tObj = Tcl_NewBooleanObj(pObj == Py_True);
+    } else if (TohilTclObj_Check(pObj) || TohilTclDict_Check(pObj)) {
+        TohilTclObj *pyTclObj = (TohilTclObj *)pObj;
+        tObj = pyTclObj->tclobj;
+        // tcl could convert the one whose bytes python is looking at
+        if (pyTclObj->exports > 0) {
+            tObj = Tcl_DuplicateObj(tObj);
+        }
+    } else if (PyBytes_Check(pObj)) {
+        tObj = Tcl_NewByteArrayObj((const unsigned char *)PyBytes_AS_STRING(pObj), PyBytes_GET_SIZE(pObj));
+    } else if (PyUnicode_Check(pObj)) {
+        tObj = tohil_PyUnicodeToTcl(pObj);
+    } else if (PyObject_CheckBuffer(pObj) && tohil_PyBufferToTcl(pObj, &tObj) != 0) {
+        // tObj is set, or NULL if the conversion failed
+    } else if (PyLong_Check(pObj)) {
+        tObj = tohil_PyLongToTclObj(pObj);
+    } else if (PyFloat_Check(pObj)) {
+        tObj = Tcl_NewDoubleObj(PyFloat_AS_DOUBLE(pObj));
+    } else if (PyNumber_Check(pObj)) {
+        /* Other numbers, complex and the like, go via string */
+        pStrObj = PyObject_Str(pObj);
+        if (pStrObj == NULL)
+            return NULL;
+        tObj = tohil_PyUnicodeToTcl(pStrObj);
+        Py_DECREF(pStrObj);
+    } else if (PyList_CheckExact(pObj) || PyTuple_CheckExact(pObj)) {
+        tObj = tohil_PySequenceToTclList(interp, pObj);
+    } else if (PyDict_CheckExact(pObj)) {
+        Py_ssize_t pos = 0;
+        tObj = Tcl_NewDictObj();
+        // the dict is held on to in case converting a key or
+        // value runs python code that drops the last reference
+        Py_INCREF(pObj);
+        while (PyDict_Next(pObj, &pos, &pKey, &pVal)) {
+            Py_INCREF(pKey);
+            Py_INCREF(pVal);
+            tKey = _pyObjToTcl(interp, pKey);
+            tVal = (tKey == NULL) ? NULL : _pyObjToTcl(interp, pVal);
+            Py_DECREF(pKey);
+            Py_DECREF(pVal);
+            if (tVal == NULL) {
+                if (tKey != NULL) {
+                    Tcl_IncrRefCount(tKey);
+                    Tcl_DecrRefCount(tKey);
+                }
+                Py_DECREF(pObj);
+                Tcl_IncrRefCount(tObj);
+                Tcl_DecrRefCount(tObj);
+                return NULL;
+            }
+            Tcl_DictObjPut(interp, tObj, tKey, tVal);
+        }
+        Py_DECREF(pObj);
+    } else if (PySequence_Check(pObj)) {
+        PyObject *pSeq = PySequence_Fast(pObj, "expected a sequence");
+        if (pSeq == NULL)
+            return NULL;
+        tObj = tohil_PySequenceToTclList(interp, pSeq);
+        Py_DECREF(pSeq);
+    } else if (PyMapping_Check(pObj)) {
+        tObj = Tcl_NewDictObj();
+        len = PyMapping_Length(pObj);
+        if (len == -1)
+            return NULL;
+        pItems = PyMapping_Items(pObj);
+        if (pItems == NULL)
+            return NULL;
+#define ONERR(VAR)         \
+    if (VAR == NULL) {     \
+        Py_DECREF(pItems); \
+        return NULL;       \
+    }
+        for (i = 0; i < len; i++) {
+            pItem = PySequence_GetItem(pItems, i);
+            ONERR(pItem)
+            pKey = PySequence_GetItem(pItem, 0);
+            ONERR(pKey)
+            pVal = PySequence_GetItem(pItem, 1);
+            ONERR(pVal)
+            tKey = _pyObjToTcl(interp, pKey);
+            Py_DECREF(pKey);
+            ONERR(tKey);
+            tVal = _pyObjToTcl(interp, pVal);
+            Py_DECREF(pVal);
+            ONERR(tVal);
+            Tcl_DictObjPut(interp, tObj, tKey, tVal);
+        }
+#undef ONERR
+        Py_DECREF(pItems);
+        /* Broke out of loop because of error */
+        if (i != len) {
+            Py_XDECREF(pItem);
+            return NULL;
+        }
+    } else if (PyAnySet_Check(pObj) || PyGen_Check(pObj) || (Py_TYPE(pObj)->tp_iter != NULL && !PyIter_Check(pObj))) {
+        /* iterators other than generators, cursors and files and such,
+         * are left alone, as turning them into a list would use them up */
+        tObj = tohil_PyIterableToTclList(interp, pObj);
+    } else {
+        /* Get python string representation of other objects */
+        pStrObj = PyObject_Str(pObj);
+        if (pStrObj == NULL)
+            return NULL;
+        tObj = tohil_PyUnicodeToTcl(pStrObj);
+        Py_DECREF(pStrObj);
+    }
+
+    return tObj;
+}
+
+static Tcl_Obj *
+pyObjToTcl(Tcl_Interp *interp, PyObject *pObj)
+{
+    Tcl_Obj *ret = _pyObjToTcl(interp, pObj);
+    // NB tcl is not prepared to accept null pointers to set interpreter results
+    // and probably even variables and stuff yet pyObjToTcl can return them.
+    // here we look to detect if it does.  later we might choose to cause an
+    // error return or some kind, or, if necessary, do checks
+    // everywhere in the code that currently assumes pyObjToTcl can't fail
+    assert(ret != NULL);
+    if (ret == NULL)
+        abort();
+    return ret;
+}
+
+//
+//
+// tcl object cache
+//
+// tohil.eval, tohil.expr and tohil.subst look up the text they are
+// given in a bounded LRU cache of tcl objects.  tcl keeps compiled
+// bytecode in the internal rep of the object being evaluated, so
+// handing tcl the same object for the same text means it only gets
+// compiled once.
+//
+// tohil::eval and tohil::exec use the same kind of cache to hang
+// onto compiled python code objects, see below.
+//
+//
+
+typedef struct TohilCacheEntry {
+    struct TohilCacheEntry *prev;
+    struct TohilCacheEntry *next;
+    Tcl_HashEntry *hashEntry;
+    Tcl_Obj *obj;
+} TohilCacheEntry;
+
+typedef struct {
+    const char *name;
+    int initialized;
+    Tcl_HashTable table;
+    TohilCacheEntry *head; // most recently used
+    TohilCacheEntry *tail; // least recently used
+    int size;
+    long hits;
+    long misses;
+} TohilObjCache;
+
+// maximum number of entries in each cache, 0 disables caching
+static int tohilCacheMaxSize = 1000;
+
+static TohilObjCache evalCache = {"eval"};
+static TohilObjCache exprCache = {"expr"};
+static TohilObjCache substCache = {"subst"};
+static TohilObjCache pyEvalCache = {"pyeval"};
+static TohilObjCache pyExecCache = {"pyexec"};
+
+static TohilObjCache *tohilCaches[] = {&evalCache, &exprCache, &substCache, &pyEvalCache, &pyExecCache, NULL};
+
+//
+// unlink a cache entry from the cache's LRU list
+//
+static void
+TohilCache_Unlink(TohilObjCache *cache, TohilCacheEntry *entry)
+{
+    if (entry->prev != NULL) {
+        entry->prev->next = entry->next;
+    } else {
+        cache->head = entry->next;
+    }
+    if (entry->next != NULL) {
+        entry->next->prev = entry->prev;
+    } else {
+        cache->tail = entry->prev;
+    }
+}
+
+//
+// link a cache entry in at the most recently used end of the LRU list
+//
+static void
+TohilCache_LinkHead(TohilObjCache *cache, TohilCacheEntry *entry)
+{
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if (cache->head != NULL) {
+        cache->head->prev = entry;
+    } else {
+        cache->tail = entry;
+    }
+    cache->head = entry;
+}
+
+//
+// remove an entry from the cache entirely, releasing its tcl object
+//
+static void
+TohilCache_Remove(TohilObjCache *cache, TohilCacheEntry *entry)
+{
+    TohilCache_Unlink(cache, entry);
+    Tcl_DeleteHashEntry(entry->hashEntry);
+    Tcl_DecrRefCount(entry->obj);
+    ckfree(entry);
+    cache->size--;
+}
+
+//
+// evict least recently used entries until the cache is no bigger than maxSize
+//
+static void
+TohilCache_Trim(TohilObjCache *cache, int maxSize)
+{
+    while (cache->size > maxSize) {
+        TohilCache_Remove(cache, cache->tail);
+    }
+}
+
+//
+// look up key in the cache, returning the cached tcl object, or NULL
+//   if it isn't there.  the object returned is owned by the cache;
+//   increment its reference count if you need to hang onto it.
+//
+static Tcl_Obj *
+TohilCache_Lookup(TohilObjCache *cache, const char *key)
+{
+    if (tohilCacheMaxSize <= 0) {
+        return NULL;
+    }
+
+    Tcl_HashEntry *hashEntry = cache->initialized ? Tcl_FindHashEntry(&cache->table, key) : NULL;
+    if (hashEntry == NULL) {
+        cache->misses++;
+        return NULL;
+    }
+
+    cache->hits++;
+    TohilCacheEntry *entry = (TohilCacheEntry *)Tcl_GetHashValue(hashEntry);
+    if (entry != cache->head) {
+        TohilCache_Unlink(cache, entry);
+        TohilCache_LinkHead(cache, entry);
+    }
+    return entry->obj;
+}
+
+//
+// add obj to the cache under key, evicting the least recently used
+//   entry if the cache is full.  does nothing if caching is disabled.
+//
+static void
+TohilCache_Insert(TohilObjCache *cache, const char *key, Tcl_Obj *obj)
+{
+    int isNew;
+
+    if (tohilCacheMaxSize <= 0) {
+        return;
+    }
+
+    if (!cache->initialized) {
+        Tcl_InitHashTable(&cache->table, TCL_STRING_KEYS);
+        cache->initialized = 1;
+    }
+
+    Tcl_HashEntry *hashEntry = Tcl_CreateHashEntry(&cache->table, key, &isNew);
+    if (!isNew) {
+        return;
+    }
+
+    TohilCacheEntry *entry = (TohilCacheEntry *)ckalloc(sizeof(TohilCacheEntry));
+    entry->hashEntry = hashEntry;
+    entry->obj = obj;
+    Tcl_IncrRefCount(obj);
+    Tcl_SetHashValue(hashEntry, entry);
+    TohilCache_LinkHead(cache, entry);
+    cache->size++;
+
+    TohilCache_Trim(cache, tohilCacheMaxSize);
+}
+
+//
+// get the tcl object corresponding to a chunk of utf-8 python text,
+//   from the cache if we've seen it before, creating and caching
+//   it if we haven't.
+//
+//   the returned object's reference count is not incremented on
+//   your behalf -- increment it while you use it and decrement it
+//   when you're done, which will free it if it isn't cached.
+//
+static Tcl_Obj *
+TohilCache_GetTextObj(TohilObjCache *cache, const char *utf8Text)
+{
+    Tcl_Obj *obj = TohilCache_Lookup(cache, utf8Text);
+    if (obj != NULL) {
+        return obj;
+    }
+
+    Tcl_DString ds;
+    char *tclText = tohil_UTF8ToTcl((char *)utf8Text, -1, &ds);
+    obj = Tcl_NewStringObj(tclText, Tcl_DStringLength(&ds));
+    Tcl_DStringFree(&ds);
+
+    TohilCache_Insert(cache, utf8Text, obj);
+    return obj;
+}
+
+//
+// PyReturnTclError - return a tcl error to the tcl interpreter
+//   with the specified string as an error message
+//
+static int
+PyReturnTclError(Tcl_Interp *interp, char *string)
+{
+    Tcl_SetObjResult(interp, Tcl_NewStringObj(string, -1));
+    return TCL_ERROR;
+}
+
+//
+// PyReturnException - return a python exception to tcl as a tcl error
+//
+static int
+PyReturnException(Tcl_Interp *interp, char *description)
+{
+    // Shouldn't call this function unless Python has excepted
+    if (PyErr_Occurred() == NULL) {
+        return PyReturnTclError(interp, "bug in tohil - PyReturnException called without a python error having occurred");
+    }
+
+    // break out the exception
+    PyObject *pType = NULL, *pVal = NULL, *pTrace = NULL;
+
+    PyErr_Fetch(&pType, &pVal, &pTrace); /* Clears exception */
+    PyErr_NormalizeException(&pType, &pVal, &pTrace);
+
+    // set tcl interpreter result
+    Tcl_SetObjResult(interp, pyObjToTcl(interp, pVal));
+
+    // invoke python tohil.handle_exception(type, val, tracebackObject)
+    // it returns a tuple consisting of the error code and error info (traceback)
+    PyObject *pExceptionResult = PyObject_CallFunctionObjArgs(pTohilHandleException, pType, pVal, pTrace, NULL);
+
+    // call tohil python exception handler function
+    // return to me a tuple containing the error string, error code, and traceback
+    if (pExceptionResult == NULL) {
+        // NB debug break out the exception
+        PyObject *pType = NULL, *pVal = NULL, *pTrace = NULL;
+        PyErr_Fetch(&pType, &pVal, &pTrace); /* Clears exception */
+        PyErr_NormalizeException(&pType, &pVal, &pTrace);
+        PyObject_Print(pType, stdout, 0);
+        PyObject_Print(pVal, stdout, 0);
+        return PyReturnTclError(interp, "some problem running the tohil python exception handler");
+    }
+
+    if (!PyTuple_Check(pExceptionResult) || PyTuple_GET_SIZE(pExceptionResult) != 2) {
+        return PyReturnTclError(interp, "malfunction in tohil python exception handler, did not return tuple or tuple did not contain 2 elements");
+    }
+
+    Tcl_SetObjErrorCode(interp, pyObjToTcl(interp, PyTuple_GET_ITEM(pExceptionResult, 0)));
+    Tcl_AppendObjToErrorInfo(interp, pyObjToTcl(interp, PyTuple_GET_ITEM(pExceptionResult, 1)));
+    Py_DECREF(pExceptionResult);
+    return TCL_ERROR;
+}
+
+//
+// tohil_FreeIntRep - free a tcl object's internal rep, leaving it with
+//   only its string rep.  make sure it has a string rep before you call this.
+//
+static void
+tohil_FreeIntRep(Tcl_Obj *obj)
+{
+    if (obj->typePtr != NULL && obj->typePtr->freeIntRepProc != NULL) {
+        obj->typePtr->freeIntRepProc(obj);
+    }
+    obj->typePtr = NULL;
+}
+
+//
+//
+// tcl "pycallable" object type
+//
+// tohil::call caches the python callable that a dotted name like
+// mod.sub.func resolves to in the internal rep of the tcl object
+// holding the name, so a tcl loop calling the same python function
+// over and over doesn't transcode the name, create python strings
+// for each component, and walk the attributes every time.
+//
+// to notice when something along the way has been rebound, we also
+// remember, for each step of the resolution, the module dict the name
+// was found in, the (interned) name, and the object it resolved to.
+// on each call we check that each of those dicts still maps each name
+// to the same object, which is a handful of hash probes with no
+// allocations.  we only cache names that resolve entirely through
+// module dicts, i.e. __main__ and modules; things like methods of
+// instances can change out from under us in too many ways.
+//
+// internalRep.twoPtrValue.ptr1 is a TohilResolvedCallable, which is
+//   reference counted so duplicated tcl objects can share it.
+//
+//
+
+typedef struct {
+    PyObject *dict;
+    PyObject *name;
+    PyObject *value;
+} TohilResolvedLink;
+
+typedef struct {
+    int refCount;
+    PyObject *callable;
+    int nLinks;
+    TohilResolvedLink links[1];
+} TohilResolvedCallable;
+
+static void PyCallableObj_FreeIntRep(Tcl_Obj *obj);
+static void PyCallableObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj);
+
+static Tcl_ObjType pyCallableObjType = {
+    "pycallable",             // name
+    PyCallableObj_FreeIntRep, // freeIntRepProc
+    PyCallableObj_DupIntRep,  // dupIntRepProc
+    NULL,                     // updateStringProc, we never lose the string rep
+    NULL,                     // setFromAnyProc
+};
+
+static void
+TohilResolvedCallable_Release(TohilResolvedCallable *resolved)
+{
+    if (--resolved->refCount > 0) {
+        return;
+    }
+
+    // python may already be gone if tcl is cleaning up at exit
+    if (Py_IsInitialized()) {
+        for (int i = 0; i < resolved->nLinks; i++) {
+            Py_DECREF(resolved->links[i].dict);
+            Py_DECREF(resolved->links[i].name);
+            Py_DECREF(resolved->links[i].value);
+        }
+        Py_XDECREF(resolved->callable);
+    }
+    ckfree(resolved);
+}
+
+static void
+PyCallableObj_FreeIntRep(Tcl_Obj *obj)
+{
+    TohilResolvedCallable_Release((TohilResolvedCallable *)obj->internalRep.twoPtrValue.ptr1);
+    obj->typePtr = NULL;
+}
+
+static void
+PyCallableObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj)
+{
+    TohilResolvedCallable *resolved = (TohilResolvedCallable *)srcObj->internalRep.twoPtrValue.ptr1;
+    resolved->refCount++;
+    dupObj->internalRep.twoPtrValue.ptr1 = resolved;
+    dupObj->typePtr = &pyCallableObjType;
+}
+
+//
+// remember that name in dict resolved to value
+//
+static void
+TohilResolvedCallable_AddLink(TohilResolvedCallable *resolved, PyObject *dict, PyObject *name, PyObject *value)
+{
+    TohilResolvedLink *link = &resolved->links[resolved->nLinks++];
+    link->dict = dict;
+    link->name = name;
+    link->value = value;
+    Py_INCREF(dict);
+    Py_INCREF(name);
+    Py_INCREF(value);
+}
+
+//
+// tohil_ResolveCallable - find the python object named by a tcl object
+//   containing a possibly dotted name, relative to __main__, using and
+//   maintaining the cached resolution in the tcl object's internal rep.
+//
+//   on success returns TCL_OK and sets *objPtr to a new reference to the
+//   python object.  on failure returns a tcl error describing the python
+//   exception.
+//
+static int
+tohil_ResolveCallable(Tcl_Interp *interp, Tcl_Obj *nameObj, PyObject **objPtr)
+{
+    static PyObject *pMainModuleName = NULL;
+    TohilResolvedCallable *resolved;
+    int i;
+
+    if (nameObj->typePtr == &pyCallableObjType) {
+        resolved = (TohilResolvedCallable *)nameObj->internalRep.twoPtrValue.ptr1;
+        for (i = 0; i < resolved->nLinks; i++) {
+            if (PyDict_GetItemWithError(resolved->links[i].dict, resolved->links[i].name) != resolved->links[i].value) {
+                break;
+            }
+        }
+        if (i == resolved->nLinks) {
+            Py_INCREF(resolved->callable);
+            *objPtr = resolved->callable;
+            return TCL_OK;
+        }
+        // something got rebound, resolve it again the slow way
+        PyErr_Clear();
+    }
+
+    if (pMainModuleName == NULL) {
+        pMainModuleName = PyUnicode_InternFromString("__main__");
+    }
+
+    /* Borrowed ref, do not decrement */
+    PyObject *pMainModule = PyImport_AddModule("__main__");
+    if (pMainModule == NULL) {
+        return PyReturnException(interp, "unable to add module __main__ to python interpreter");
+    }
+
+    Tcl_DString ds;
+    const char *objandfn = tohil_TclObjToUTF8(nameObj, &ds);
+
+    // one link for finding __main__ in sys.modules, and one per name component
+    int maxLinks = 2;
+    for (const char *p = objandfn; *p != '\0'; p++) {
+        if (*p == '.') {
+            maxLinks++;
+        }
+    }
+    resolved = (TohilResolvedCallable *)ckalloc(sizeof(TohilResolvedCallable) + sizeof(TohilResolvedLink) * (maxLinks - 1));
+    resolved->refCount = 1;
+    resolved->callable = NULL;
+    resolved->nLinks = 0;
+    TohilResolvedCallable_AddLink(resolved, PyImport_GetModuleDict(), pMainModuleName, pMainModule);
+    int cacheable = 1;
+
+    /* So we don't have to special case the decref in the following loop */
+    Py_INCREF(pMainModule);
+    PyObject *pObj = pMainModule;
+    const char *component = objandfn;
+    while (1) {
+        const char *dot = strchr(component, '.');
+        Py_ssize_t len = (dot == NULL) ? (Py_ssize_t)strlen(component) : dot - component;
+
+        PyObject *pName = PyUnicode_FromStringAndSize(component, len);
+        if (pName == NULL) {
+            Py_DECREF(pObj);
+            Tcl_DStringFree(&ds);
+            TohilResolvedCallable_Release(resolved);
+            return PyReturnException(interp, "failed unicode translation of call function in python interpreter");
+        }
+        PyUnicode_InternInPlace(&pName);
+
+        PyObject *pNext = PyObject_GetAttr(pObj, pName);
+        if (pNext == NULL) {
+            Py_DECREF(pName);
+            Py_DECREF(pObj);
+            Tcl_DStringFree(&ds);
+            TohilResolvedCallable_Release(resolved);
+            return PyReturnException(interp, dot != NULL ? "failed to find dotted attribute in python interpreter"
+                                                         : "failed to find object/function in python interpreter");
+        }
+
+        // we can only vouch for the resolution later if it came straight out of a module dict
+        if (cacheable && PyModule_Check(pObj) && PyDict_GetItemWithError(PyModule_GetDict(pObj), pName) == pNext) {
+            TohilResolvedCallable_AddLink(resolved, PyModule_GetDict(pObj), pName, pNext);
+        } else {
+            PyErr_Clear();
+            cacheable = 0;
+        }
+
+        Py_DECREF(pName);
+        Py_DECREF(pObj);
+        pObj = pNext;
+
+        if (dot == NULL) {
+            break;
+        }
+        component = dot + 1;
+    }
+    Tcl_DStringFree(&ds);
+
+    if (cacheable) {
+        resolved->callable = pObj;
+        Py_INCREF(pObj);
+
+        // the string rep is what we resolved, make sure it's there
+        // before we throw away whatever internal rep the object has
+        Tcl_GetString(nameObj);
+        tohil_FreeIntRep(nameObj);
+        nameObj->internalRep.twoPtrValue.ptr1 = resolved;
+        nameObj->typePtr = &pyCallableObjType;
+    } else {
+        TohilResolvedCallable_Release(resolved);
+    }
+
+    *objPtr = pObj;
+    return TCL_OK;
+}
+
+//
+//
+// end of tcl "pycallable" object type
+//
+//
+
+//
+//
+// tcl "pyobject" object type
+//
+// tohil.pyref(obj) hands tcl a reference to a python object rather than
+// a conversion of it.  the object rides in the internal rep and comes
+// back out, itself, when tcl passes it to tohil::call or returns it to
+// python, so a big python structure can go through tcl code that only
+// stores and forwards it without being converted either way.
+//
+// the string rep is made only if tcl asks for it, using the usual python
+// to tcl conversion, and once tcl changes the object into something else
+// the python object is let go.  the string rep is kept like any other,
+// so a referenced object mutated by python afterwards leaves tcl with
+// the old string.  tcl values aren't supposed to change, and other
+// holders may be using the string, so we can't drop it then; referenced
+// objects just mustn't be mutated.
+//
+// internalRep.twoPtrValue.ptr1 is the python object, which we hold a
+// reference to.  tcl only runs in the thread that has python, but we
+// take the GIL anyway in case some other thread is the one letting go.
+//
+//
+
+static void PyObjectObj_FreeIntRep(Tcl_Obj *obj);
+static void PyObjectObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj);
+static void PyObjectObj_UpdateString(Tcl_Obj *obj);
+
+static Tcl_ObjType pyObjectObjType = {
+    "pyobject",               // name
+    PyObjectObj_FreeIntRep,   // freeIntRepProc
+    PyObjectObj_DupIntRep,    // dupIntRepProc
+    PyObjectObj_UpdateString, // updateStringProc
+    NULL,                     // setFromAnyProc, only tohil.pyref makes these
+};
+
+static void
+PyObjectObj_FreeIntRep(Tcl_Obj *obj)
+{
+    // python may already be gone if tcl is cleaning up at exit
+    if (Py_IsInitialized()) {
+        PyGILState_STATE gilState = PyGILState_Ensure();
+        Py_DECREF((PyObject *)obj->internalRep.twoPtrValue.ptr1);
+        PyGILState_Release(gilState);
+    }
+    obj->typePtr = NULL;
+}
+
+static void
+PyObjectObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj)
+{
+    PyObject *pObj = (PyObject *)srcObj->internalRep.twoPtrValue.ptr1;
+    PyGILState_STATE gilState = PyGILState_Ensure();
+    Py_INCREF(pObj);
+    PyGILState_Release(gilState);
+    dupObj->internalRep.twoPtrValue.ptr1 = pObj;
+    dupObj->typePtr = &pyObjectObjType;
+}
+
+//
+// PyObjectObj_UpdateString - give a pyobject the string rep the python
+//   object would have converted to.  tcl can't be told the conversion
+//   failed, so if it does the string is empty.
+//
+static void
+PyObjectObj_UpdateString(Tcl_Obj *obj)
+{
+    PyGILState_STATE gilState = PyGILState_Ensure();
+    PyObject *pType, *pVal, *pTrace;
+    PyErr_Fetch(&pType, &pVal, &pTrace);
+
+    Tcl_Obj *stringObj = _pyObjToTcl(tcl_interp, (PyObject *)obj->internalRep.twoPtrValue.ptr1);
+    if (stringObj == NULL) {
+        PyErr_Clear();
+        stringObj = Tcl_NewObj();
+    }
+    Tcl_IncrRefCount(stringObj);
+
+    int length;
+    const char *string = Tcl_GetStringFromObj(stringObj, &length);
+    obj->bytes = ckalloc(length + 1);
+    memcpy(obj->bytes, string, length + 1);
+    obj->length = length;
+    Tcl_DecrRefCount(stringObj);
+
+    PyErr_Restore(pType, pVal, pTrace);
+    PyGILState_Release(gilState);
+}
+
+//
+// tohil_PyObjectObjGet - return a new reference to the python object
+//   a pyobject refers to
+//
+static PyObject *
+tohil_PyObjectObjGet(Tcl_Obj *obj)
+{
+    PyObject *pObj = (PyObject *)obj->internalRep.twoPtrValue.ptr1;
+    Py_INCREF(pObj);
+    return pObj;
+}
+
+//
+//
+// end of tcl "pyobject" object type
+//
+//
+
+//
+//
+// tcl "pybuffer" object type
+//
+// tohil.pybuffer(obj) hands tcl the bytes of a python buffer, like a
+// bytes, bytearray, memoryview or mmap, without copying them.  the
+// internal rep holds the Py_buffer, which keeps the exporter alive and,
+// for things like bytearray, keeps it from being resized.  when the value
+// comes back to python, it comes back as the exporter.
+//
+// tcl 8.6 byte arrays can't point at storage they don't own, so when tcl
+// wants the value as a byte array, for binary scan or a channel write, it
+// converts it from the string rep, which is made only then, and the
+// buffer is let go.  pybuffer pays off for bytes that go through tcl
+// without tcl looking at them.
+//
+// internalRep.twoPtrValue.ptr1 is a TohilPyBuffer, which is reference
+//   counted so duplicated tcl objects can share it.
+//
+//
+
+typedef struct {
+    int refCount;
+    Py_buffer view;
+} TohilPyBuffer;
+
+static void PyBufferObj_FreeIntRep(Tcl_Obj *obj);
+static void PyBufferObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj);
+static void PyBufferObj_UpdateString(Tcl_Obj *obj);
+
+static Tcl_ObjType pyBufferObjType = {
+    "pybuffer",               // name
+    PyBufferObj_FreeIntRep,   // freeIntRepProc
+    PyBufferObj_DupIntRep,    // dupIntRepProc
+    PyBufferObj_UpdateString, // updateStringProc
+    NULL,                     // setFromAnyProc, only tohil.pybuffer makes these
+};
+
+static void
+PyBufferObj_FreeIntRep(Tcl_Obj *obj)
+{
+    TohilPyBuffer *buffer = (TohilPyBuffer *)obj->internalRep.twoPtrValue.ptr1;
+    if (--buffer->refCount == 0) {
+        // python may already be gone if tcl is cleaning up at exit
+        if (Py_IsInitialized()) {
+            PyGILState_STATE gilState = PyGILState_Ensure();
+            PyBuffer_Release(&buffer->view);
+            PyGILState_Release(gilState);
+        }
+        ckfree(buffer);
+    }
+    obj->typePtr = NULL;
+}
+
+static void
+PyBufferObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj)
+{
+    TohilPyBuffer *buffer = (TohilPyBuffer *)srcObj->internalRep.twoPtrValue.ptr1;
+    buffer->refCount++;
+    dupObj->internalRep.twoPtrValue.ptr1 = buffer;
+    dupObj->typePtr = &pyBufferObjType;
+}
+
+//
+// PyBufferObj_UpdateString - give a pybuffer the string rep a tcl byte
+//   array with the same bytes would have
+//
+static void
+PyBufferObj_UpdateString(Tcl_Obj *obj)
+{
+    TohilPyBuffer *buffer = (TohilPyBuffer *)obj->internalRep.twoPtrValue.ptr1;
+    Tcl_Obj *bytesObj = Tcl_NewByteArrayObj((const unsigned char *)buffer->view.buf, (int)buffer->view.len);
+    Tcl_IncrRefCount(bytesObj);
+
+    int length;
+    const char *string = Tcl_GetStringFromObj(bytesObj, &length);
+    obj->bytes = ckalloc(length + 1);
+    memcpy(obj->bytes, string, length + 1);
+    obj->length = length;
+    Tcl_DecrRefCount(bytesObj);
+}
+
+//
+// tohil_PyBufferObjGet - return a new reference to the python object
+//   that exported a pybuffer's buffer
+//
+static PyObject *
+tohil_PyBufferObjGet(Tcl_Obj *obj)
+{
+    PyObject *pObj = ((TohilPyBuffer *)obj->internalRep.twoPtrValue.ptr1)->view.obj;
+    Py_INCREF(pObj);
+    return pObj;
+}
+
+//
+//
+// end of tcl "pybuffer" object type
+//
+//
+
+//
+// call python from tcl with very explicit arguments versus
+//   slamming stuff through eval
+//
+static int
+TohilCall_Cmd(ClientData clientData, /* Not used. */
+              Tcl_Interp *interp,    /* Current interpreter */
+              int objc,              /* Number of arguments */
+              Tcl_Obj *const objv[]  /* Argument strings */
+)
+{
+    if (objc < 2) {
+    wrongargs:
+        Tcl_WrongNumArgs(interp, 1, objv, "?-kwlist list? func ?arg ...?");
+        return TCL_ERROR;
+    }
+
+    PyObject *kwObj = NULL;
+    Tcl_Obj *funcObj = objv[1];
+    int objStart = 2;
+
+    // "-kwlist" is the same in tcl's utf-8 and real utf-8, no need to transcode
+    const char *firstArg = Tcl_GetString(objv[1]);
+    if (*firstArg == '-' && STREQU(firstArg, "-kwlist")) {
+        if (objc < 4)
+            goto wrongargs;
+        kwObj = tclListObjToPyDictObject(interp, objv[2]);
+        funcObj = objv[3];
+        objStart = 4;
+        if (kwObj == NULL) {
+            return TCL_ERROR;
+        }
+    }
+
+    PyObject *pFn = NULL;
+    if (tohil_ResolveCallable(interp, funcObj, &pFn) == TCL_ERROR) {
+        Py_XDECREF(kwObj);
+        return TCL_ERROR;
+    }
+
+    if (!PyCallable_Check(pFn)) {
+        Py_DECREF(pFn);
+        Py_XDECREF(kwObj);
+        return PyReturnException(interp, "function is not callable");
+    }
+
+    // if there are no positional arguments, we will
+    // call PyTuple_New with a 0 argument, producing
+    // a 0-length tuple.  whil PyObject_Call's kwargs
+    // argument can be NULL, args must not; an empty
+    // tuple should be used
+    int i;
+    PyObject *pArgs = PyTuple_New(objc - objStart);
+    PyObject *curarg = NULL;
+    for (i = objStart; i < objc; i++) {
+        if (objv[i]->typePtr == &pyObjectObjType) {
+            PyTuple_SET_ITEM(pArgs, i - objStart, tohil_PyObjectObjGet(objv[i]));
+            continue;
+        }
+        curarg = tohil_TclObjToPyString(objv[i]);
+        if (curarg == NULL) {
+            Py_DECREF(pArgs);
+            Py_DECREF(pFn);
+            Py_XDECREF(kwObj);
+            return PyReturnException(interp, "unicode string conversion failed");
+        }
+        /* Steals a reference */
+        PyTuple_SET_ITEM(pArgs, i - objStart, curarg);
+    }
+
+    PyObject *pRet = PyObject_Call(pFn, pArgs, kwObj);
+    Py_DECREF(pFn);
+    Py_DECREF(pArgs);
+    if (kwObj != NULL)
+        Py_DECREF(kwObj);
+    if (pRet == NULL)
+        return PyReturnException(interp, "error in python object call");
+
+    Tcl_Obj *tRet = pyObjToTcl(interp, pRet);
+    Py_DECREF(pRet);
+    if (tRet == NULL)
+        return PyReturnException(interp, "error converting python object to tcl object");
+
+    Tcl_SetObjResult(interp, tRet);
+    return TCL_OK;
+}
+
+//
+// implements tcl command tohil::import, to import a python module
+//   into the python interpreter.
+//
+static int
+TohilImport_Cmd(ClientData clientData, /* Not used. */
+                Tcl_Interp *interp,    /* Current interpreter */
+                int objc,              /* Number of arguments */
+                Tcl_Obj *const objv[]  /* Argument strings */
+)
+{
+    const char *modname, *topmodname;
+    PyObject *pMainModule, *pTopModule;
+    int ret = -1;
+
+    if (objc != 2) {
+        Tcl_WrongNumArgs(interp, 1, objv, "module");
+        return TCL_ERROR;
+    }
+
+    modname = Tcl_GetString(objv[1]);
+
+    /* Borrowed ref, do not decrement */
+    pMainModule = PyImport_AddModule("__main__");
+    if (pMainModule == NULL)
+        return PyReturnException(interp, "add module __main__ failed");
+
+    pTopModule = PyImport_ImportModule(modname);
+    if (pTopModule == NULL)
+        return PyReturnException(interp, "import module failed");
+
+    topmodname = PyModule_GetName(pTopModule);
+    if (topmodname != NULL) {
+        ret = PyObject_SetAttrString(pMainModule, topmodname, pTopModule);
+    }
+    Py_DECREF(pTopModule);
+
+    if (ret < 0)
+        return PyReturnException(interp, "while trying to import a module");
+
+    return TCL_OK;
+}
+
+//
+//
+// tcl "pycode" object type
+//
+// tohil::eval and tohil::exec compile the python code they're given
+// and cache the resulting python code object in the internal rep of
+// the tcl object holding the code, so a proc running the same python
+// snippet over and over only compiles it once.  if the internal rep
+// gets shimmered away, a cache keyed by the code's string has another
+// copy.
+//
+// internalRep.twoPtrValue.ptr1 is the python code object
+// internalRep.twoPtrValue.ptr2 is the python start symbol it was compiled
+//   with, Py_eval_input or Py_file_input
+//
+//
+
+static void PyCodeObj_FreeIntRep(Tcl_Obj *obj);
+static void PyCodeObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj);
+
+static Tcl_ObjType pyCodeObjType = {
+    "pycode",             // name
+    PyCodeObj_FreeIntRep, // freeIntRepProc
+    PyCodeObj_DupIntRep,  // dupIntRepProc
+    NULL,                 // updateStringProc, we never lose the string rep
+    NULL,                 // setFromAnyProc
+};
+
+static void
+PyCodeObj_FreeIntRep(Tcl_Obj *obj)
+{
+    // python may already be gone if tcl is cleaning up at exit
+    if (Py_IsInitialized()) {
+        Py_DECREF((PyObject *)obj->internalRep.twoPtrValue.ptr1);
+    }
+    obj->typePtr = NULL;
+}
+
+static void
+PyCodeObj_DupIntRep(Tcl_Obj *srcObj, Tcl_Obj *dupObj)
+{
+    PyObject *code = (PyObject *)srcObj->internalRep.twoPtrValue.ptr1;
+    Py_INCREF(code);
+    dupObj->internalRep.twoPtrValue.ptr1 = code;
+    dupObj->internalRep.twoPtrValue.ptr2 = srcObj->internalRep.twoPtrValue.ptr2;
+    dupObj->typePtr = &pyCodeObjType;
+}
+
+//
+// set a tcl object's internal rep to be a python code object
+//
+static void
+PyCodeObj_SetIntRep(Tcl_Obj *obj, PyObject *code, int start)
+{
+    // the string rep is our key, make sure it's there before
+    // we throw away whatever internal rep the object has
+    Tcl_GetString(obj);
+    tohil_FreeIntRep(obj);
+    Py_INCREF(code);
+    obj->internalRep.twoPtrValue.ptr1 = code;
+    obj->internalRep.twoPtrValue.ptr2 = INT2PTR(start);
+    obj->typePtr = &pyCodeObjType;
+}
+
+//
+// tohil_CompileTclObj - return a new reference to the python code object
+//   for the python code in a tcl object, compiling it only if we haven't
+//   already.  start is Py_eval_input or Py_file_input.
+//
+//   returns NULL with a python error set if compilation fails.
+//
+static PyObject *
+tohil_CompileTclObj(Tcl_Obj *obj, int start)
+{
+    PyObject *code;
+
+    if (obj->typePtr == &pyCodeObjType && PTR2INT(obj->internalRep.twoPtrValue.ptr2) == start) {
+        code = (PyObject *)obj->internalRep.twoPtrValue.ptr1;
+        Py_INCREF(code);
+        return code;
+    }
+
+    TohilObjCache *cache = (start == Py_eval_input) ? &pyEvalCache : &pyExecCache;
+    const char *key = Tcl_GetString(obj);
+    Tcl_Obj *cachedObj = TohilCache_Lookup(cache, key);
+
+    if (cachedObj != NULL) {
+        // objects in the cache are private to it and never shimmer
+        assert(cachedObj->typePtr == &pyCodeObjType);
+        code = (PyObject *)cachedObj->internalRep.twoPtrValue.ptr1;
+        Py_INCREF(code);
+    } else {
+        Tcl_DString ds;
+        const char *utf8Code = tohil_TclObjToUTF8(obj, &ds);
+        code = Py_CompileStringFlags(utf8Code, "tohil", start, NULL);
+        Tcl_DStringFree(&ds);
+        if (code == NULL) {
+            return NULL;
+        }
+
+        cachedObj = Tcl_NewStringObj(key, obj->length);
+        PyCodeObj_SetIntRep(cachedObj, code, start);
+        TohilCache_Insert(cache, key, cachedObj);
+        // frees it if caching is disabled
+        Tcl_IncrRefCount(cachedObj);
+        Tcl_DecrRefCount(cachedObj);
+    }
+
+    PyCodeObj_SetIntRep(obj, code, start);
+    return code;
+}
+
+//
+//
+// end of tcl "pycode" object type
+//
+//
+
+static int
+TohilEval_Cmd(ClientData clientData, /* Not used. */
+              Tcl_Interp *interp,    /* Current interpreter */
+              int objc,              /* Number of arguments */
+              Tcl_Obj *const objv[]  /* Argument strings */
+)
+{
+    if (objc != 2) {
+        Tcl_WrongNumArgs(interp, 1, objv, "evalString");
+        return TCL_ERROR;
+    }
+
+    PyObject *code = tohil_CompileTclObj(objv[1], Py_eval_input);
+    if (code == NULL) {
+        return PyReturnException(interp, "while compiling python eval code");
+    }
+
+    PyObject *main_module = PyImport_AddModule("__main__");
+    PyObject *global_dict = PyModule_GetDict(main_module);
+    PyObject *pyobj = PyEval_EvalCode(code, global_dict, global_dict);
+
+    Py_XDECREF(code);
+
+    if (pyobj == NULL) {
+        return PyReturnException(interp, "while evaluating python code");
+    }
+
+    Tcl_SetObjResult(interp, pyObjToTcl(interp, pyobj));
+    Py_XDECREF(pyobj);
+    return TCL_OK;
+}
+
+// awfully similar to TohilEval_Cmd above
+// but expecting to do more like capture stdout
+static int
+TohilExec_Cmd(ClientData clientData, /* Not used. */
+              Tcl_Interp *interp,    /* Current interpreter */
+              int objc,              /* Number of arguments */
+              Tcl_Obj *const objv[]  /* Argument strings */
+)
+{
+    if (objc != 2) {
+        Tcl_WrongNumArgs(interp, 1, objv, "execString");
+        return TCL_ERROR;
+    }
+
+    PyObject *code = tohil_CompileTclObj(objv[1], Py_file_input);
+    if (code == NULL) {
+        return PyReturnException(interp, "while compiling python exec code");
+    }
+
+    PyObject *main_module = PyImport_AddModule("__main__");
+    PyObject *global_dict = PyModule_GetDict(main_module);
+    PyObject *pyobj = PyEval_EvalCode(code, global_dict, global_dict);
+
+    Py_XDECREF(code);
+
+    if (pyobj == NULL) {
+        return PyReturnException(interp, "while evaluating python code");
+    }
+
+    Tcl_SetObjResult(interp, pyObjToTcl(interp, pyobj));
+    Py_XDECREF(pyobj);
+    return TCL_OK;
+}
+
+//
+// implements tcl-side tohil::interact command to launch the python
+//   interpreter's interactive loop
+//
+static int
+TohilInteract_Cmd(ClientData clientData, /* Not used. */
+                  Tcl_Interp *interp,    /* Current interpreter */
+                  int objc,              /* Number of arguments */
+                  Tcl_Obj *const objv[]  /* Argument strings */
+)
+{
+    if (objc != 1) {
+        Tcl_WrongNumArgs(interp, 1, objv, "");
+        return TCL_ERROR;
+    }
+
+#ifndef PYPY_VERSION
+    int result = PyRun_InteractiveLoop(stdin, "stdin");
+    if (result < 0) {
+        return PyReturnException(interp, "interactive loop failure");
+    }
+#else
+    return PyReturnException(interp, "interactive loop not supported with pypy");
+#endif
+
+    return TCL_OK;
+}
+
+/* Python library begins here */
+
+//
+//
+// argument parsing for fast calls
+//
+// our python functions and methods are METH_FASTCALL | METH_KEYWORDS,
+// and our callable types use vectorcall where python has it, so python
+// hands us its argument vector and a tuple of keyword names rather than
+// building an argument tuple and keyword dict for every call.  these
+// helpers parse that without allocating anything.
+//
+//
+
+// python 3.9 made vectorcall public, pypy's cpyext doesn't have it.
+// without it our callable types get a tp_call that unpacks the
+// argument tuple and keyword dict into a vector for the same code.
+#if PY_VERSION_HEX >= 0x03090000 && !defined(PYPY_VERSION)
+#define TOHIL_VECTORCALL 1
+typedef vectorcallfunc tohil_vectorcallfunc;
+#define TOHIL_NARGS(nargsf) PyVectorcall_NARGS(nargsf)
+#else
+typedef PyObject *(*tohil_vectorcallfunc)(PyObject *callable, PyObject *const *args, size_t nargsf, PyObject *kwnames);
+#define TOHIL_NARGS(nargsf) ((Py_ssize_t)(nargsf))
+#endif
+
+//
+// tohil_parse_args - parse positional arguments and keyword arguments
+//   named in kwnames, whose values follow the positional ones in args,
+//   against the NULL-terminated list of parameter names in kwlist.
+//
+//   the first maxPositional parameters may be passed positionally and
+//   the first minArgs are required.  values[i] is set to a borrowed
+//   reference to the argument for kwlist[i], or NULL if it wasn't given.
+//
+//   returns 0 on success, or -1 with a TypeError set
+//
+static int
+tohil_parse_args(const char *fname, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames, const char *const kwlist[], int minArgs,
+                 int maxPositional, PyObject **values)
+{
+    int nParams = 0;
+    int i;
+
+    while (kwlist[nParams] != NULL) {
+        values[nParams++] = NULL;
+    }
+
+    if (nargs > maxPositional) {
+        PyErr_Format(PyExc_TypeError, "%s() takes at most %d positional argument%s (%zd given)", fname, maxPositional,
+                     maxPositional == 1 ? "" : "s", nargs);
+        return -1;
+    }
+
+    for (i = 0; i < nargs; i++) {
+        values[i] = args[i];
+    }
+
+    if (kwnames != NULL) {
+        Py_ssize_t nkw = PyTuple_GET_SIZE(kwnames);
+        for (Py_ssize_t k = 0; k < nkw; k++) {
+            PyObject *key = PyTuple_GET_ITEM(kwnames, k);
+            for (i = 0; i < nParams; i++) {
+                if (PyUnicode_CompareWithASCIIString(key, kwlist[i]) == 0) {
+                    break;
+                }
+            }
+            if (i == nParams) {
+                PyErr_Format(PyExc_TypeError, "%s() got an unexpected keyword argument '%U'", fname, key);
+                return -1;
+            }
+            if (values[i] != NULL) {
+                PyErr_Format(PyExc_TypeError, "%s() got multiple values for argument '%s'", fname, kwlist[i]);
+                return -1;
+            }
+            values[i] = args[nargs + k];
+        }
+    }
+
+    for (i = 0; i < minArgs; i++) {
+        if (values[i] == NULL) {
+            PyErr_Format(PyExc_TypeError, "%s() missing required argument '%s' (pos %d)", fname, kwlist[i], i + 1);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+//
+// tohil_parse_to - find the to= keyword argument among the keyword
+//   arguments to a call that otherwise takes only positional arguments.
+//
+//   sets *toPtr if to= was given and leaves it alone otherwise.
+//   returns 0 on success, or -1 with a TypeError set if there are
+//   any other keyword arguments
+//
+static int
+tohil_parse_to(const char *fname, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames, PyTypeObject **toPtr)
+{
+    if (kwnames == NULL) {
+        return 0;
+    }
+
+    Py_ssize_t nkw = PyTuple_GET_SIZE(kwnames);
+    if (nkw != 1 || PyUnicode_CompareWithASCIIString(PyTuple_GET_ITEM(kwnames, 0), "to") != 0) {
+        PyErr_Format(PyExc_TypeError, "%s arguments must be positional, to= is the only keyword argument accepted", fname);
+        return -1;
+    }
+    *toPtr = (PyTypeObject *)args[nargs];
+    return 0;
+}
+
+//
+// tohil_parse_utf8 - get the utf-8 of a str argument, like "s" does for
+//   PyArg_ParseTuple.  returns NULL with an exception set on failure.
+//
+static const char *
+tohil_parse_utf8(const char *fname, const char *argname, PyObject *obj)
+{
+    Py_ssize_t size;
+
+    if (!PyUnicode_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "%s() argument '%s' must be str, not %.50s", fname, argname, Py_TYPE(obj)->tp_name);
+        return NULL;
+    }
+
+    const char *utf8 = PyUnicode_AsUTF8AndSize(obj, &size);
+    if (utf8 != NULL && (Py_ssize_t)strlen(utf8) != size) {
+        PyErr_SetString(PyExc_ValueError, "embedded null character");
+        return NULL;
+    }
+    return utf8;
+}
+
+//
+// tohil_parse_long - get the value of an integer argument, like "l" does
+//   for PyArg_ParseTuple.  returns -1 with an exception set on failure.
+//
+static int
+tohil_parse_long(PyObject *obj, long *longPtr)
+{
+    if (PyFloat_Check(obj)) {
+        PyErr_SetString(PyExc_TypeError, "integer argument expected, got float");
+        return -1;
+    }
+
+    long value = PyLong_AsLong(obj);
+    if (value == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    *longPtr = value;
+    return 0;
+}
+
+#ifndef TOHIL_VECTORCALL
+//
+// tohil_tp_call - call one of our vectorcall functions from a tp_call,
+//   for pythons without vectorcall
+//
+static PyObject *
+tohil_tp_call(tohil_vectorcallfunc func, PyObject *callable, PyObject *args, PyObject *kwargs)
+{
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t nkw = (kwargs == NULL) ? 0 : PyDict_GET_SIZE(kwargs);
+
+    if (nkw == 0) {
+        return func(callable, &PyTuple_GET_ITEM(args, 0), nargs, NULL);
+    }
+
+    PyObject **stack = PyMem_Malloc(sizeof(PyObject *) * (nargs + nkw));
+    PyObject *kwnames = PyTuple_New(nkw);
+    if (stack == NULL || kwnames == NULL) {
+        PyMem_Free(stack);
+        Py_XDECREF(kwnames);
+        return PyErr_NoMemory();
+    }
+
+    Py_ssize_t i;
+    for (i = 0; i < nargs; i++) {
+        stack[i] = PyTuple_GET_ITEM(args, i);
+    }
+
+    Py_ssize_t pos = 0;
+    PyObject *key, *value;
+    for (i = 0; PyDict_Next(kwargs, &pos, &key, &value); i++) {
+        stack[nargs + i] = value;
+        Py_INCREF(key);
+        PyTuple_SET_ITEM(kwnames, i, key);
+    }
+
+    PyObject *pRet = func(callable, stack, nargs, kwnames);
+    PyMem_Free(stack);
+    Py_DECREF(kwnames);
+    return pRet;
+}
+#endif
+
+//
+//
+// end of argument parsing for fast calls
+//
+//
+
+//
+//
+// python tcl object "tclobj"
+//
+//
+
+//
+// return true if python object is a tclobj type
+//
+int
+TohilTclObj_Check(PyObject *pyObj)
+{
+    return PyObject_TypeCheck(pyObj, &TohilTclObjType);
+}
+
+//
+// create a new python tclobj object from a tclobj
+//
+static PyObject *
+TohilTclObj_FromTclObj(Tcl_Obj *obj)
+{
+    TohilTclObj *self = (TohilTclObj *)TohilTclObjType.tp_alloc(&TohilTclObjType, 0);
+    if (self != NULL) {
+        self->interp = tcl_interp;
+        self->tclobj = obj;
+        self->to = NULL;
+        Tcl_IncrRefCount(obj);
+    }
+    return (PyObject *)self;
+}
+
+//
+// create a new python tclobj object
+//
+// creates an empty object if no argument is given, but if an
+// argument is provided, performs pyObjToTcl conversion on it
+// and makes the new tclobj object point to that
+//
+static PyObject *
+TohilTclObj_create(PyTypeObject *type, PyObject *pSource, PyObject *toType)
+{
+    if (toType != NULL) {
+        if (!PyType_Check(toType)) {
+            PyErr_SetString(PyExc_RuntimeError, "to type is not a valid python data type");
+            return NULL;
+        }
+    }
+
+    TohilTclObj *self = (TohilTclObj *)type->tp_alloc(type, 0);
+    if (self != NULL) {
+        self->interp = tcl_interp;
+        if (pSource == NULL) {
+            if (PyType_IsSubtype(type, &TohilTclDictType)) {
+                self->tclobj = Tcl_NewDictObj();
+            } else {
+                self->tclobj = Tcl_NewObj();
+            }
+        } else if ((self->tclobj = _pyObjToTcl(self->interp, pSource)) == NULL) {
+            // conversion can fail, a buffer too big for a tcl list say
+            self->tclobj = Tcl_NewObj();
+            Tcl_IncrRefCount(self->tclobj);
+            Py_DECREF(self);
+            return NULL;
+        }
+        Tcl_IncrRefCount(self->tclobj);
+        self->to = (PyTypeObject *)toType;
+        Py_XINCREF(toType);
+    }
+    return (PyObject *)self;
+}
+
+static PyObject *
+TohilTclObj_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *pSource = NULL;
+    PyObject *toType = NULL;
+    static char *kwlist[] = {"from", "to", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O$O", kwlist, &pSource, &toType)) {
+        return NULL;
+    }
+    return TohilTclObj_create(type, pSource, toType);
+}
+
+#ifdef TOHIL_VECTORCALL
+//
+// vectorcall for the tclobj and tcldict types themselves, so creating
+//   them doesn't go through an argument tuple and keyword dict.  our
+//   tp_init doesn't do anything so there's no need to call it.
+//
+static PyObject *
+TohilTclObj_vectorcall_new(PyObject *type, PyObject *const *args, size_t nargsf, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"from", "to", NULL};
+    PyObject *values[2];
+
+    if (tohil_parse_args(((PyTypeObject *)type)->tp_name, args, PyVectorcall_NARGS(nargsf), kwnames, kwlist, 0, 1, values) < 0) {
+        return NULL;
+    }
+    return TohilTclObj_create((PyTypeObject *)type, values[0], values[1]);
+}
+#endif
+
+//
+// deallocate function for python tclobj type
+//
+static void
+TohilTclObj_dealloc(TohilTclObj *self)
+{
+    Tcl_DecrRefCount(self->tclobj);
+    Py_XDECREF(self->to);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+//
+// init function for python tclobj type
+//
+static int
+TohilTclObj_init(TohilTclObj *self, PyObject *args, PyObject *kwds)
+{
+    if (TohilTclObj_Exported(self)) {
+        return -1;
+    }
+
+    return 0;
+}
+
+//
+// str() method for python tclobj type
+//
+static PyObject *
+TohilTclObj_str(TohilTclObj *self)
+{
+    return tohil_TclObjToPyString(self->tclobj);
+}
+
+//
+// repr() method for python tclobj type
+//
+static PyObject *
+TohilTclObj_repr(TohilTclObj *self)
+{
+    PyObject *stringRep = tohil_TclObjToPyString(self->tclobj);
+    if (stringRep == NULL) {
+        return NULL;
+    }
+    char *format = PyUnicode_GET_LENGTH(stringRep) > 100 ? "<%s: %.100R...>" : "<%s: %.100R>";
+    PyObject *repr = PyUnicode_FromFormat(format, Py_TYPE(self)->tp_name, stringRep);
+    Py_DECREF(stringRep);
+    return repr;
+}
+
+//
+// richcompare() method for python tclobj type
+//
+static PyObject *
+TohilTclObj_richcompare(TohilTclObj *self, PyObject *other, int op)
+{
+
+    // NB ugh other isn't necessarily a TohilTclObj
+
+    // if you want equal and they point to the exact same object,
+    // we are donezo
+    if (op == Py_EQ && (TohilTclObj_Check(other) || TohilTclDict_Check(other)) && self->tclobj == ((TohilTclObj *)other)->tclobj) {
+        Py_INCREF(Py_True);
+        return Py_True;
+    }
+
+    char *selfString = Tcl_GetString(self->tclobj);
+
+    char *otherString = NULL;
+    Tcl_Obj *otherObj = NULL;
+    if (TohilTclObj_Check(other) || TohilTclDict_Check(other)) {
+        otherString = Tcl_GetString(((TohilTclObj *)other)->tclobj);
+    } else {
+        otherObj = pyObjToTcl(self->interp, other);
+        otherString = Tcl_GetString(otherObj);
+    }
+
+    int cmp = strcmp(selfString, otherString);
+    int res = 0;
+
+    switch (op) {
+    case Py_LT:
+        res = (cmp < 0);
+        break;
+
+    case Py_LE:
+        res = (cmp <= 0);
+        break;
+
+    case Py_EQ:
+        res = (cmp == 0);
+        break;
+
+    case Py_NE:
+        res = (cmp != 0);
+        break;
+
+    case Py_GT:
+        res = (cmp > 0);
+        break;
+
+    case Py_GE:
+        res = (cmp >= 0);
+        break;
+
+    default:
+        assert(0 == 1);
+    }
+    if (otherObj != NULL) {
+        Tcl_DecrRefCount(otherObj);
+    }
+    PyObject *p = (res ? Py_True : Py_False);
+    Py_INCREF(p);
+    return p;
+}
+
+//
+// tclobj.reset() - reset a tclobj or tcldict to an empty tcl object
+//
+static PyObject *
+TohilTclObj_reset(TohilTclObj *self, PyObject *pyobj)
+{
+    if (TohilTclObj_Exported(self)) {
+        return NULL;
+    }
+
+    Tcl_DecrRefCount(self->tclobj);
+    self->tclobj = Tcl_NewObj();
+    Py_XDECREF(self->to);
+    self->to = NULL;
+    Tcl_IncrRefCount(self->tclobj);
+    Py_RETURN_NONE;
+}
+
+//
+// tclobj.as_int()
+//
+static PyObject *
+TohilTclObj_as_int(TohilTclObj *self, PyObject *pyobj)
+{
+    PyObject *pLong = tohil_TclObjToPyLong(self->interp, self->tclobj);
+
+    if (pLong == NULL && !PyErr_Occurred()) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    }
+    return pLong;
+}
+
+//
+// tclobj.as_float()
+//
+static PyObject *
+TohilTclObj_as_float(TohilTclObj *self, PyObject *pyobj)
+{
+    double doubleValue;
+
+    if (Tcl_GetDoubleFromObj(self->interp, self->tclobj, &doubleValue) == TCL_OK) {
+        return PyFloat_FromDouble(doubleValue);
+    }
+    PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    return NULL;
+}
+
+//
+// tclobj.as_bool()
+//
+static PyObject *
+TohilTclObj_as_bool(TohilTclObj *self, PyObject *pyobj)
+{
+    int intValue;
+    if (Tcl_GetBooleanFromObj(self->interp, self->tclobj, &intValue) == TCL_OK) {
+        PyObject *p = (intValue ? Py_True : Py_False);
+        Py_INCREF(p);
+        return p;
+    }
+    PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    return NULL;
+}
+
+//
+// tclobj.as_string()
+//
+static PyObject *
+TohilTclObj_as_string(TohilTclObj *self, PyObject *pyobj)
+{
+    return tohil_TclObjToPyString(self->tclobj);
+}
+
+//
+// tclobj.as_list()
+//
+static PyObject *
+TohilTclObj_as_list(TohilTclObj *self, PyObject *pyobj)
+{
+    return tclListObjToPyListObject(self->interp, self->tclobj);
+}
+
+//
+// tclobj.as_set()
+//
+static PyObject *
+TohilTclObj_as_set(TohilTclObj *self, PyObject *pyobj)
+{
+    return tclListObjToPySetObject(self->interp, self->tclobj);
+}
+
+//
+// tclobj.as_tuple()
+//
+static PyObject *
+TohilTclObj_as_tuple(TohilTclObj *self, PyObject *pyobj)
+{
+    return tclListObjToPyTupleObject(self->interp, self->tclobj);
+}
+
+//
+// tclobj.as_dict()
+//
+static PyObject *
+TohilTclObj_as_dict(TohilTclObj *self, PyObject *pyobj)
+{
+    return tclListObjToPyDictObject(self->interp, self->tclobj);
+}
+
+//
+// tclobj.as_tclobj()
+//
+static PyObject *
+TohilTclObj_as_tclobj(TohilTclObj *self, PyObject *pyobj)
+{
+    if (TohilTclObj_Exported(self)) {
+        return NULL;
+    }
+
+    return TohilTclObj_FromTclObj(self->tclobj);
+}
+
+//
+// tclobj.as_tcldict()
+//
+static PyObject *
+TohilTclObj_as_tcldict(TohilTclObj *self, PyObject *pyobj)
+{
+    if (TohilTclObj_Exported(self)) {
+        return NULL;
+    }
+
+    return TohilTclDict_FromTclObj(self->tclobj);
+}
+
+//
+// tclobj.as_byte_array()
+//
+static PyObject *
+TohilTclObj_as_byte_array(TohilTclObj *self, PyObject *pyobj)
+{
+    Tcl_Obj *obj = self->tclobj;
+    int size;
+
+    // a pure string is about to be a byte array anyway, and so is one
+    // only carrying our cached pystr, but anything with a list, dict,
+    // number or other rep would lose it, so the bytes come from a
+    // throwaway copy of the string instead.  that's what tcl would have
+    // done, the low byte of each character.
+    if (obj->typePtr != NULL && obj->typePtr != tclByteArrayType && obj->typePtr != &pyStrObjType) {
+        const char *string = Tcl_GetStringFromObj(obj, &size);
+        obj = Tcl_NewStringObj(string, size);
+    }
+
+    Tcl_IncrRefCount(obj);
+    unsigned char *byteArray = Tcl_GetByteArrayFromObj(obj, &size);
+    PyObject *pByteArray = PyByteArray_FromStringAndSize((const char *)byteArray, size);
+    Tcl_DecrRefCount(obj);
+    return pByteArray;
+}
+
+//
+// tohil_StoreArrayItem - convert a tcl list element to the C type of
+//   array typecode and store it at dest.  set a python error and return
+//   -1 if it isn't a number of that kind or doesn't fit.
+//
+#define TOHIL_STORE_INT(ctype, min, max)                                                                             \
+    {                                                                                                                \
+        ctype value;                                                                                                 \
+        if (wide < (min) || wide > (max)) {                                                                          \
+            PyErr_Format(PyExc_OverflowError, "%s is out of range for array typecode '%c'", Tcl_GetString(obj), typecode); \
+            return -1;                                                                                               \
+        }                                                                                                            \
+        value = (ctype)wide;                                                                                         \
+        memcpy(dest, &value, sizeof(value));                                                                         \
+        return 0;                                                                                                    \
+    }
+
+//
+// tohil_StoreArrayUWide - store obj at dest as an unsigned 64-bit array
+//   item.  tcl keeps numbers above LLONG_MAX as bignums, so those are
+//   read from the bignum's digits.
+//
+static int
+tohil_StoreArrayUWide(Tcl_Interp *interp, Tcl_Obj *obj, char typecode, char *dest)
+{
+    Tcl_WideInt wide;
+    Tcl_WideUInt value = 0;
+    int fits;
+
+    // checked after, since getting a wide int can parse it into a bignum
+    if (Tcl_GetWideIntFromObj(NULL, obj, &wide) == TCL_OK && obj->typePtr != tclBignumType) {
+        fits = (wide >= 0);
+        value = (Tcl_WideUInt)wide;
+    } else {
+        mp_int big;
+        if (Tcl_GetBignumFromObj(interp, obj, &big) != TCL_OK) {
+            PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+            return -1;
+        }
+        fits = (big.sign != MP_NEG && mp_count_bits(&big) <= 64);
+        for (int i = big.used - 1; fits && i >= 0; i--) {
+            value = (value << MP_DIGIT_BIT) | big.dp[i];
+        }
+        mp_clear(&big);
+    }
+
+    if (!fits) {
+        PyErr_Format(PyExc_OverflowError, "%s is out of range for array typecode '%c'", Tcl_GetString(obj), typecode);
+        return -1;
+    }
+    memcpy(dest, &value, sizeof(value));
+    return 0;
+}
+
+static int
+tohil_StoreArrayItem(Tcl_Interp *interp, Tcl_Obj *obj, char typecode, char *dest)
+{
+    if (typecode == 'f' || typecode == 'd') {
+        double doubleValue;
+        if (Tcl_GetDoubleFromObj(interp, obj, &doubleValue) != TCL_OK) {
+            PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+            return -1;
+        }
+        if (typecode == 'f') {
+            float floatValue = (float)doubleValue;
+            memcpy(dest, &floatValue, sizeof(floatValue));
+        } else {
+            memcpy(dest, &doubleValue, sizeof(doubleValue));
+        }
+        return 0;
+    }
+
+    if (typecode == 'Q' || (typecode == 'L' && sizeof(unsigned long) == sizeof(Tcl_WideUInt))) {
+        return tohil_StoreArrayUWide(interp, obj, typecode, dest);
+    }
+
+    Tcl_WideInt wide;
+    if (Tcl_GetWideIntFromObj(interp, obj, &wide) != TCL_OK) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        return -1;
+    }
+
+    switch (typecode) {
+    case 'b':
+        TOHIL_STORE_INT(signed char, SCHAR_MIN, SCHAR_MAX)
+    case 'B':
+        TOHIL_STORE_INT(unsigned char, 0, UCHAR_MAX)
+    case 'h':
+        TOHIL_STORE_INT(short, SHRT_MIN, SHRT_MAX)
+    case 'H':
+        TOHIL_STORE_INT(unsigned short, 0, USHRT_MAX)
+    case 'i':
+        TOHIL_STORE_INT(int, INT_MIN, INT_MAX)
+    case 'I':
+        TOHIL_STORE_INT(unsigned int, 0, UINT_MAX)
+    case 'l':
+        TOHIL_STORE_INT(long, LONG_MIN, LONG_MAX)
+    case 'L':
+        TOHIL_STORE_INT(unsigned long, 0, (Tcl_WideInt)(ULONG_MAX > LLONG_MAX ? LLONG_MAX : ULONG_MAX))
+    default:
+        TOHIL_STORE_INT(long long, LLONG_MIN, LLONG_MAX)
+    }
+}
+
+//
+// tohil_ArrayItemSize - return the size of the items of an array.array
+//   of typecode pTypecode, which has to be one of the typecodes for
+//   numbers, setting *typecode to it.  set a ValueError and return -1
+//   if it isn't.
+//
+static Py_ssize_t
+tohil_ArrayItemSize(PyObject *pTypecode, char *typecode)
+{
+    static const char typecodes[] = "bBhHiIlLqQfd";
+    static const size_t itemsizes[] = {sizeof(signed char), sizeof(unsigned char), sizeof(short), sizeof(unsigned short),
+                                       sizeof(int), sizeof(unsigned int), sizeof(long), sizeof(unsigned long),
+                                       sizeof(long long), sizeof(unsigned long long), sizeof(float), sizeof(double)};
+
+    const char *code = PyUnicode_Check(pTypecode) ? PyUnicode_AsUTF8(pTypecode) : NULL;
+    if (code == NULL || code[0] == '\0' || code[1] != '\0' || strchr(typecodes, code[0]) == NULL) {
+        PyErr_Clear();
+        PyErr_SetString(PyExc_ValueError, "array typecode must be one of b, B, h, H, i, I, l, L, q, Q, f or d");
+        return -1;
+    }
+    *typecode = code[0];
+    return (Py_ssize_t)itemsizes[strchr(typecodes, code[0]) - typecodes];
+}
+
+//
+// tohil_NewArray - return a new array.array of typecode holding the
+//   items of pInit, as array.array(typecode, pInit) would
+//
+static PyObject *
+tohil_NewArray(char typecode, PyObject *pInit)
+{
+    static PyObject *pArrayType = NULL;
+
+    if (pArrayType == NULL) {
+        PyObject *pArrayModule = PyImport_ImportModule("array");
+        if (pArrayModule == NULL) {
+            return NULL;
+        }
+        pArrayType = PyObject_GetAttrString(pArrayModule, "array");
+        Py_DECREF(pArrayModule);
+        if (pArrayType == NULL) {
+            return NULL;
+        }
+    }
+    return PyObject_CallFunction(pArrayType, "CO", typecode, pInit);
+}
+
+//
+// tohil_NewFilledArray - return a new array.array of count zeroed items
+//   of typecode, with view set to a writable buffer over them, so the
+//   caller can fill them in place.  the caller releases view.
+//
+static PyObject *
+tohil_NewFilledArray(char typecode, Py_ssize_t count, Py_buffer *view)
+{
+    PyObject *pZero = Py_BuildValue("[i]", 0);
+    if (pZero == NULL) {
+        return NULL;
+    }
+    PyObject *pOne = tohil_NewArray(typecode, pZero);
+    Py_DECREF(pZero);
+    if (pOne == NULL) {
+        return NULL;
+    }
+    PyObject *pArray = PySequence_Repeat(pOne, count);
+    Py_DECREF(pOne);
+    if (pArray == NULL) {
+        return NULL;
+    }
+    if (PyObject_GetBuffer(pArray, view, PyBUF_WRITABLE) < 0) {
+        Py_DECREF(pArray);
+        return NULL;
+    }
+    return pArray;
+}
+
+//
+// tclobj.as_array(typecode) - return tclobj, a tcl list of numbers, as an
+//   array.array of typecode.
+//
+// the numbers are stored straight into the array from the elements'
+// int or double reps, so a list of a million doubles never becomes a
+// million python floats, and element strings are only parsed if tcl
+// hasn't already done it.
+//
+static PyObject *
+TohilTclObj_as_array(TohilTclObj *self, PyObject *pTypecode)
+{
+    char typecode;
+    Py_ssize_t itemsize = tohil_ArrayItemSize(pTypecode, &typecode);
+    if (itemsize < 0) {
+        return NULL;
+    }
+
+    int count;
+    Tcl_Obj **list;
+    if (Tcl_ListObjGetElements(self->interp, self->tclobj, &count, &list) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    // the numbers go straight into the array's own storage
+    Py_buffer view;
+    PyObject *pArray = tohil_NewFilledArray(typecode, count, &view);
+    if (pArray == NULL) {
+        return NULL;
+    }
+    char *dest = (char *)view.buf;
+    for (int i = 0; i < count; i++, dest += itemsize) {
+        if (tohil_StoreArrayItem(self->interp, list[i], typecode, dest) < 0) {
+            PyBuffer_Release(&view);
+            Py_DECREF(pArray);
+            return NULL;
+        }
+    }
+    PyBuffer_Release(&view);
+    return pArray;
+}
+
+//
+// tohil.tclobj.from_buffer(buf) - return a tclobj containing a tcl list
+//   of the numbers in buf, which can be anything exporting a contiguous
+//   buffer of ints, floats or bools, like an array.array, a memoryview,
+//   or a numpy array.  buffers of more than one dimension make lists of
+//   lists.
+//
+static PyObject *
+TohilTclObj_from_buffer(PyObject *dummy, PyObject *pBuf)
+{
+    Py_buffer view;
+
+    if (PyObject_GetBuffer(pBuf, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+        return NULL;
+    }
+
+    char kind = tohil_BufferKind(&view);
+    if (kind == 0) {
+        PyErr_Format(PyExc_ValueError, "can't make tcl numbers from buffer format '%s'", (view.format == NULL) ? "B" : view.format);
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    Tcl_Obj *listObj = tohil_BufferToTcl(&view, kind);
+    PyBuffer_Release(&view);
+    if (listObj == NULL) {
+        return NULL;
+    }
+    return TohilTclObj_FromTclObj(listObj);
+}
+
+void
+TohilTclObj_dup_if_shared(TohilTclObj *self)
+{
+    if (!Tcl_IsShared(self->tclobj)) {
+        return;
+    }
+
+    tohil_ChurnDup(self->tclobj);
+
+    // decrement the old object.  It's safe because refcount
+    // must be 2 or more.  then duplicate and increment
+    // the new, duplicated object's 0 refcount to 1
+    Tcl_DecrRefCount(self->tclobj);
+    self->tclobj = Tcl_DuplicateObj(self->tclobj);
+    Tcl_IncrRefCount(self->tclobj);
+}
+
+//
+// tclobj.incr() - increment a python tclobj object
+//
+static PyObject *
+TohilTclObj_incr(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"incr", NULL};
+    PyObject *values[1];
+    long longValue = 0;
+    long increment = 1;
+
+    if (tohil_parse_args("incr", args, nargs, kwnames, kwlist, 0, 1, values) < 0) {
+        return NULL;
+    }
+
+    if (values[0] != NULL && tohil_parse_long(values[0], &increment) < 0) {
+        return NULL;
+    }
+
+    if (Tcl_GetLongFromObj(self->interp, self->tclobj, &longValue) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    longValue += increment;
+
+    TohilTclObj_dup_if_shared(self);
+    Tcl_SetLongObj(self->tclobj, longValue);
+    return PyLong_FromLong(longValue);
+}
+
+//
+// convert a python list into a tcl c-level objv and objc
+//
+// pyListToTclObjv(pList, &objc, &objv);
+//
+// you must call pyListToObjv_teardown when done or you'll
+// leak memory
+//
+static void
+pyListToTclObjv(PyListObject *pList, int *intPtr, Tcl_Obj ***objvPtr)
+{
+    int i;
+
+    assert(PyList_Check(pList));
+    Py_ssize_t objc = PyList_GET_SIZE(pList);
+    // build up a tcl objv of the list elements
+    Tcl_Obj **objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
+    for (i = 0; i < objc; i++) {
+        objv[i] = pyObjToTcl(tcl_interp, PyList_GET_ITEM(pList, i));
+        Tcl_IncrRefCount(objv[i]);
+    }
+    *objvPtr = objv;
+    *intPtr = objc;
+}
+
+//
+// teardown an objv created by pyListToObjv
+//
+static void
+pyListToObjv_teardown(int objc, Tcl_Obj **objv)
+{
+    int i;
+
+    // tear down the objv of the keys we created
+    for (i = 0; i < objc; i++) {
+        Tcl_DecrRefCount(objv[i]);
+    }
+    ckfree(objv);
+}
+
+//
+// llength - return the length of a python tclobj's tcl object
+//   as a list.  exception thrown if tcl object isn't a list
+//
+static PyObject *
+TohilTclObj_llength(TohilTclObj *self, PyObject *pyobj)
+{
+    int length;
+    if (Tcl_ListObjLength(self->interp, self->tclobj, &length) == TCL_OK) {
+        return PyLong_FromLong(length);
+    }
+    PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    return NULL;
+}
+
+//
+// getvar - set python tclobj to contain the value of a tcl var
+//
+static PyObject *
+TohilTclObj_getvar(TohilTclObj *self, PyObject *var)
+{
+    if (TohilTclObj_Exported(self)) {
+        return NULL;
+    }
+
+    char *varString = (char *)PyUnicode_1BYTE_DATA(var);
+    Tcl_Obj *newObj = Tcl_GetVar2Ex(self->interp, varString, NULL, (TCL_LEAVE_ERR_MSG));
+    if (newObj == NULL) {
+        PyErr_SetString(PyExc_NameError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+    Tcl_DecrRefCount(self->tclobj);
+    self->tclobj = newObj;
+    Tcl_IncrRefCount(self->tclobj);
+    Py_RETURN_NONE;
+}
+
+//
+// setvar - set set tcl var to point to the tcl object of a python tclobj
+//
+static PyObject *
+TohilTclObj_setvar(TohilTclObj *self, PyObject *var)
+{
+    if (TohilTclObj_Exported(self)) {
+        return NULL;
+    }
+
+    char *varString = (char *)PyUnicode_1BYTE_DATA(var);
+    // setvar handles incrementing the reference count
+    if (Tcl_SetVar2Ex(self->interp, varString, NULL, self->tclobj, (TCL_LEAVE_ERR_MSG)) == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+//
+// set - tclobj type set method can set an object to a lot
+// of possible python stuff -- NB there must be a better way
+//
+static PyObject *
+TohilTclObj_set(TohilTclObj *self, PyObject *pyObject)
+{
+    if (TohilTclObj_Exported(self)) {
+        return NULL;
+    }
+
+    Tcl_Obj *newObj = pyObjToTcl(self->interp, pyObject);
+    if (newObj == NULL) {
+        return NULL;
+    }
+    Tcl_DecrRefCount(self->tclobj);
+    self->tclobj = newObj;
+    Tcl_IncrRefCount(self->tclobj);
+
+    Py_RETURN_NONE;
+}
+
+//
+// lindex - obtain the n'th element of tclobj as a tcl list.
+//
+// to=type can be used to control what python type is returned.
+//
+static PyObject *
+TohilTclObj_lindex(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"index", "to", NULL};
+    PyObject *values[2];
+    long longIndex = 0;
+    int length = 0;
+
+    if (tohil_parse_args("lindex", args, nargs, kwnames, kwlist, 1, 1, values) < 0 || tohil_parse_long(values[0], &longIndex) < 0)
+        return NULL;
+
+    if (longIndex < INT_MIN || longIndex > INT_MAX) {
+        PyErr_SetString(PyExc_IndexError, "list index out of range");
+        return NULL;
+    }
+    int index = (int)longIndex;
+    PyTypeObject *to = (PyTypeObject *)values[1];
+
+    if (Tcl_ListObjLength(self->interp, self->tclobj, &length) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    if (index < 0 || index >= length) {
+        PyErr_SetString(PyExc_IndexError, "list index out of range");
+        return NULL;
+    }
+
+    Tcl_Obj *resultObj = NULL;
+    if (Tcl_ListObjIndex(self->interp, self->tclobj, index, &resultObj) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    if (to == NULL && self->to != NULL)
+        to = self->to;
+
+    return tohil_python_return(self->interp, TCL_OK, to, resultObj);
+}
+
+//
+// lappend something to the tclobj
+//
+static PyObject *
+TohilTclObj_lappend(TohilTclObj *self, PyObject *pObject)
+{
+    Tcl_Obj *newObj = pyObjToTcl(self->interp, pObject);
+    if (newObj == NULL) {
+        return NULL;
+    }
+
+    // we are about to modify the object so if it's shared we need to copy
+    // NB i think we don't increment here because ListObjAppendElement
+    // will do it for us.
+    if (Tcl_IsShared(self->tclobj)) {
+        tohil_ChurnDup(self->tclobj);
+        Tcl_DecrRefCount(self->tclobj);
+        self->tclobj = Tcl_DuplicateObj(self->tclobj);
+    }
+
+    if (Tcl_ListObjAppendElement(self->interp, self->tclobj, newObj) == TCL_ERROR) {
+        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        Tcl_DecrRefCount(newObj);
+        return NULL;
+    }
+    // it worked
+    Py_RETURN_NONE;
+}
+
+//
+// lappend_list, lappend a list of something to the tclobj
+//
+// if append object is a tclobj and the tclobj contents can be
+// treated as a list, it will be appended as the list
+//
+// if append object is a python list then its contents will be
+// appended to the list while being converted to tcl objects
+//
+static PyObject *
+TohilTclObj_lappend_list(TohilTclObj *self, PyObject *pObject)
+{
+
+    // if passed python object is a tclobj, use tcl list C stuff
+    // to append the list to the list
+    if (TohilTclObj_Check(pObject)) {
+        Tcl_Obj *appendListObj = ((TohilTclObj *)pObject)->tclobj;
+
+        // appending converts it to a list, which would free the bytes
+        // of a byte array python is looking at, so append a copy
+        if (((TohilTclObj *)pObject)->exports > 0) {
+            appendListObj = Tcl_DuplicateObj(appendListObj);
+        }
+        Tcl_IncrRefCount(appendListObj);
+
+        if (Tcl_IsShared(self->tclobj)) {
+            tohil_ChurnDup(self->tclobj);
+            Tcl_DecrRefCount(self->tclobj);
+            self->tclobj = Tcl_DuplicateObj(self->tclobj);
+        }
+
+        if (Tcl_ListObjAppendList(self->interp, self->tclobj, appendListObj) == TCL_ERROR) {
+            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+            Tcl_DecrRefCount(appendListObj);
+            return NULL;
+        }
+        Tcl_DecrRefCount(appendListObj);
+        // if passed python object is a python list, use that and our
+        // python-to-tcl stuff to make a tcl list of it, and append
+        // that list to the tclobj's object, which is a list or an error
+        // is forthcoming
+    } else if (PyList_Check(pObject)) {
+        int objc;
+        Tcl_Obj **objv = NULL;
+
+        pyListToTclObjv((PyListObject *)pObject, &objc, &objv);
+        Tcl_Obj *appendListObj = Tcl_NewListObj(objc, objv);
+        pyListToObjv_teardown(objc, objv);
+
+        if (Tcl_IsShared(self->tclobj)) {
+            tohil_ChurnDup(self->tclobj);
+            Tcl_DecrRefCount(self->tclobj);
+            self->tclobj = Tcl_DuplicateObj(self->tclobj);
+        }
+
+        if (Tcl_ListObjAppendList(self->interp, self->tclobj, appendListObj) == TCL_ERROR) {
+            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+            Tcl_DecrRefCount(appendListObj);
+            return NULL;
+        }
+    } else {
+        PyErr_Format(PyExc_TypeError, "lappend_list argument must be a tclobj or list, not %.200s", Py_TYPE(pObject)->tp_name);
+        return NULL;
+    }
+
+    // it worked
+    Py_RETURN_NONE;
+}
+
+//
+// TohilTclObj_refcount - return the reference count of the
+//   tclobj or tcldict's internal tcl object
+//
+static PyObject *
+TohilTclObj_refcount(TohilTclObj *self, PyObject *dummy)
+{
+    return PyLong_FromLong(self->tclobj->refCount);
+}
+
+//
+// TohilTclObj_type - return the internal tcl data type of
+//   the corresponding tclobj/tcldict python type
+//
+//   this can use useful but it's not canonical - the type
+//   may not have been set to anything if the string therein
+//   hasn't been used as a list, dict, etc.
+//
+static PyObject *
+TohilTclObj_type(TohilTclObj *self, PyObject *dummy)
+{
+    const Tcl_ObjType *typePtr = self->tclobj->typePtr;
+    if (typePtr == NULL) {
+        Py_RETURN_NONE;
+    }
+    return Py_BuildValue("s", self->tclobj->typePtr->name);
+}
+
+//
+//
+// start of tclobj iterator python datatype
+//
+//
+
+// the iterator holds a reference to the tcl object it is iterating
+// over, which makes it shared, so nobody can modify it in place out
+// from under us.  we crack it into an objv once, up front.  something
+// could still shimmer it to a different type while we're iterating,
+// freeing the list rep and our objv along with it, so we remember the
+// internal rep we cracked and recrack the list if it's gone away.
+typedef struct {
+    PyObject_HEAD;
+    int index;
+    int objc;
+    Tcl_Obj **objv;
+    void *listRep;
+    PyTypeObject *to;
+    Tcl_Interp *interp;
+    Tcl_Obj *listObj;
+} PyTohil_TclObj_IterObj;
+
+static void
+PyTohil_TclObj_IterDealloc(PyTohil_TclObj_IterObj *self)
+{
+    if (self->listObj != NULL)
+        Tcl_DecrRefCount(self->listObj);
+    Py_XDECREF(self->to);
+    PyObject_Del(self);
+}
+
+PyObject *
+PyTohil_TclObj_iternext(PyTohil_TclObj_IterObj *self)
+{
+    if (self->listObj == NULL) {
+        return NULL;
+    }
+
+    if (self->listObj->typePtr != tclListType || self->listObj->internalRep.twoPtrValue.ptr1 != self->listRep) {
+        if (Tcl_ListObjGetElements(self->interp, self->listObj, &self->objc, &self->objv) == TCL_ERROR) {
+            PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+            return NULL;
+        }
+        self->listRep = self->listObj->internalRep.twoPtrValue.ptr1;
+    }
+
+    if (self->index >= self->objc) {
+        // we're done, let go of the tcl object now rather than
+        // waiting for the iterator to be garbage collected
+        Tcl_DecrRefCount(self->listObj);
+        self->listObj = NULL;
+        return NULL;
+    }
+
+    return tohil_python_return(self->interp, TCL_OK, self->to, self->objv[self->index++]);
+}
+
+//
+// __length_hint__ - lets list(tclobj) and friends presize
+//
+static PyObject *
+PyTohil_TclObj_IterLengthHint(PyTohil_TclObj_IterObj *self, PyObject *dummy)
+{
+    if (self->listObj == NULL || self->index >= self->objc) {
+        return PyLong_FromLong(0);
+    }
+    return PyLong_FromLong(self->objc - self->index);
+}
+
+static PyMethodDef PyTohil_TclObj_IterMethods[] = {
+    {"__length_hint__", (PyCFunction)PyTohil_TclObj_IterLengthHint, METH_NOARGS, "estimate of the number of elements remaining"},
+    {NULL} // sentinel
+};
+
+static PyTypeObject PyTohil_TclObj_IterType = {
+    .tp_name = "tohil._tclobj_iter",
+    .tp_basicsize = sizeof(PyTohil_TclObj_IterObj),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "tohil tclobj iterator object",
+    .tp_dealloc = (destructor)PyTohil_TclObj_IterDealloc,
+    .tp_iter = PyObject_SelfIter,
+    .tp_iternext = (iternextfunc)PyTohil_TclObj_iternext,
+    .tp_methods = PyTohil_TclObj_IterMethods,
+};
+
+//
+// TohilTclObjIter() - returns an iterator object that walks the
+//   elements of a tclobj's tcl object as a list, converting
+//   each according to the tclobj's to= type
+//
+static PyObject *
+TohilTclObjIter(TohilTclObj *self)
+{
+    int objc;
+    Tcl_Obj **objv;
+
+    if (Tcl_ListObjGetElements(self->interp, self->tclobj, &objc, &objv) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    PyTohil_TclObj_IterObj *pIter = PyObject_New(PyTohil_TclObj_IterObj, &PyTohil_TclObj_IterType);
+    if (pIter == NULL) {
+        return NULL;
+    }
+
+    pIter->index = 0;
+    pIter->objc = objc;
+    pIter->objv = objv;
+    pIter->interp = self->interp;
+    pIter->to = self->to;
+    Py_XINCREF(pIter->to);
+    pIter->listObj = self->tclobj;
+    Tcl_IncrRefCount(pIter->listObj);
+    pIter->listRep = pIter->listObj->internalRep.twoPtrValue.ptr1;
+
+    return (PyObject *)pIter;
+}
+
+//
+//
+// end of tclobj iterator python datatype
+//
+//
+
+static PyObject *TohilTclObj_subscript(TohilTclObj *, PyObject *);
+
+//
+// TohilTclObj_slice - return a python list containing a slice
+//   of the referenced tclobj as a list.
+//
+// significantly cribbed from cpython source for listobjects...
+//
+static PyObject *
+TohilTclObj_slice(TohilTclObj *self, Py_ssize_t ilow, Py_ssize_t ihigh)
+{
+    PyListObject *np;
+    int listObjc;
+    Tcl_Obj **listObjv;
+    Tcl_Obj **src;
+    Py_ssize_t i, len;
+    len = ihigh - ilow;
+
+    int size = 0;
+
+    // get the list size and crack the list into a list objc and objv.
+    // any failure here probably means the object can't be represented as a list.
+    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    if (Tcl_ListObjGetElements(self->interp, self->tclobj, &listObjc, &listObjv) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    np = (PyListObject *)PyList_New(len);
+    if (np == NULL) {
+        return NULL;
+    }
+
+    // src is a pointer to an array of pointers of obj,
+    // adjust it to the starting object and we'll walk it forward
+    src = &listObjv[ilow];
+    for (i = 0; i < len; i++) {
+        // create a new tclobj object and store
+        // it into the python list we are making
+        PyObject *v = tohil_python_return(self->interp, TCL_OK, self->to, src[i]);
+        PyList_SET_ITEM(np, i, v);
+    }
+    return (PyObject *)np;
+}
+
+//
+// TohilTclObj_item - return the i'th element of a tclobj containing
+//   a list, or set an error and return NULL if something's wrong
+//
+static PyObject *
+TohilTclObj_item(TohilTclObj *self, Py_ssize_t i)
+{
+    int size = 0;
+
+    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    if (i < 0 || i >= size) {
+        PyErr_SetString(PyExc_IndexError, "list index out of range");
+        return NULL;
+    }
+
+    int listObjc;
+    Tcl_Obj **listObjv;
+
+    if (Tcl_ListObjGetElements(self->interp, self->tclobj, &listObjc, &listObjv) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    PyObject *ret = tohil_python_return(self->interp, TCL_OK, self->to, listObjv[i]);
+    Py_INCREF(ret);
+    return ret;
+}
+
+//
+// TohilTclObj_ass_item - assign an item into a tclobj containing a list
+//
+static int
+TohilTclObj_ass_item(TohilTclObj *self, Py_ssize_t i, PyObject *v)
+{
+    int size = 0;
+
+    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return -1;
+    }
+
+    if (i < 0 || i >= size) {
+        PyErr_SetString(PyExc_IndexError, "list assignment index out of range");
+        return -1;
+    }
+
+    if (v == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "slice assignment not implemented");
+        return -1;
+        // return list_ass_slice(self, i, i+1, v);
+    }
+
+    Tcl_Obj *obj = pyObjToTcl(self->interp, v);
+    if (obj == NULL) {
+        return -1;
+    }
+
+    // we are about to modify the object so if it's shared we need to copy
+    if (Tcl_IsShared(self->tclobj)) {
+        tohil_ChurnDup(self->tclobj);
+        Tcl_DecrRefCount(self->tclobj);
+        self->tclobj = Tcl_DuplicateObj(self->tclobj);
+    }
+
+    if (Tcl_ListObjReplace(self->interp, self->tclobj, i, 1, 1, &obj) == TCL_ERROR) {
+        PyErr_SetString(PyExc_IndexError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return -1;
+    }
+    return 0;
+}
+
+//
+// TohilTclObj_length - return the length of the tclobj, looking at it
+//   as a tcl list.  returns -1 if string cannot be represented as
+//   a list, or 0 or larger, representing the number of elements
+//   in the list.
+//
+//
+static Py_ssize_t
+TohilTclObj_length(TohilTclObj *self, Py_ssize_t i)
+{
+    int size = 0;
+
+    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return -1;
+    }
+
+    return size;
+}
+
+//
+// TohilTclObj_subscript - subscript a tclobj.  we treat the tclobj
+//   as a list, so item can be an integer (to obtain a single element),
+//   or a slice (to obtain zero or more elements.)
+//
+static PyObject *
+TohilTclObj_subscript(TohilTclObj *self, PyObject *item)
+{
+    int size = 0;
+
+    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        return NULL;
+    }
+
+    if (PyIndex_Check(item)) {
+        Py_ssize_t i;
+        i = PyNumber_AsSsize_t(item, PyExc_IndexError);
+        if (i == -1 && PyErr_Occurred())
+            return NULL;
+        if (i < 0)
+            i += size;
+
+        if (i < 0 || i >= size) {
+            PyErr_SetString(PyExc_IndexError, "list index out of range");
+            return NULL;
+        }
+
+        Tcl_Obj *resultObj = NULL;
+        if (Tcl_ListObjIndex(self->interp, self->tclobj, i, &resultObj) == TCL_ERROR) {
+            PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+            return NULL;
+        }
+        return tohil_python_return(self->interp, TCL_OK, self->to, resultObj);
+    } else if (PySlice_Check(item)) {
+        Py_ssize_t start, stop, step, slicelength, i;
+        size_t cur;
+        PyObject *result;
+        PyObject *it;
+
+        if (PySlice_Unpack(item, &start, &stop, &step) < 0) {
+            return NULL;
+        }
+
+        slicelength = PySlice_AdjustIndices(size, &start, &stop, step);
+
+        if (slicelength <= 0) {
+            return tohil_python_return(self->interp, TCL_OK, self->to, Tcl_NewObj());
+        } else if (step == 1) {
+            return TohilTclObj_slice(self, start, stop);
+        } else {
+            result = PyList_New(slicelength);
+            if (!result)
+                return NULL;
+
+            int listObjc;
+            Tcl_Obj **listObjv;
+
+            if (Tcl_ListObjGetElements(self->interp, self->tclobj, &listObjc, &listObjv) == TCL_ERROR) {
+                PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+                return NULL;
+            }
 
-    int utf8len;
-    char *utf8string;
-    if (tohil_TclToUTF8(tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+            for (cur = start, i = 0; i < slicelength; cur += (size_t)step, i++) {
+                it = tohil_python_return(self->interp, TCL_OK, self->to, listObjv[cur]);
+                PyList_SET_ITEM(result, i, it);
+            }
+            return result;
+        }
+    } else {
+        PyErr_Format(PyExc_TypeError, "list indices must be integers or slices, not %.200s", Py_TYPE(item)->tp_name);
         return NULL;
     }
-    PyObject *pObj = Py_BuildValue("s#", utf8string, utf8len);
-    ckfree(utf8string);
-    return pObj;
 }
 
 //
-// repr() method for python tclobj type
 //
+// end of python tcl object "tclobj"
+//
+//
+
+//
+//
+// start of tclobj td_iterator python datatype
+//
+//
+
+typedef struct {
+    PyObject_HEAD;
+    int started;
+    int done;
+    PyTypeObject *to;
+    Tcl_Interp *interp;
+    Tcl_Obj *dictObj;
+    Tcl_DictSearch search;
+} PyTohil_TD_IterObj;
+
 static PyObject *
-TohilTclObj_repr(TohilTclObj *self)
+PyTohil_TD_iter(PyTohil_TD_IterObj *self)
 {
-    Tcl_DString ds;
-    char *utf8string = tohil_TclObjToUTF8(self->tclobj, &ds);
+    // printf("PyTohil_TD_iter\n");
+    Py_INCREF(self);
 
-    PyObject *stringRep = PyUnicode_FromFormat("%s", utf8string);
-    char *format = PyUnicode_GET_LENGTH(stringRep) > 100 ? "<%s: %.100R...>" : "<%s: %.100R>";
-    Tcl_DStringFree(&ds);
-    PyObject *repr = PyUnicode_FromFormat(format, Py_TYPE(self)->tp_name, stringRep);
-    Py_DECREF(stringRep);
-    return repr;
+    self->started = 0;
+    self->done = 0;
+
+    return (PyObject *)self;
 }
 
 //
-// richcompare() method for python tclobj type
+// td's iternext - we have to do the DictObjFirst here since
+//   tcl's version, first gives you also the first result.
 //
-static PyObject *
-TohilTclObj_richcompare(TohilTclObj *self, PyObject *other, int op)
+PyObject *
+PyTohil_TD_iternext(PyTohil_TD_IterObj *self)
 {
+    // printf("PyTohil_TD_iternext\n");
+    Tcl_Obj *keyObj = NULL;
+    Tcl_Obj *valueObj = NULL;
+    int done = 0;
 
-    // NB ugh other isn't necessarily a TohilTclObj
-
-    // if you want equal and they point to the exact same object,
-    // we are donezo
-    if (op == Py_EQ && (TohilTclObj_Check(other) || TohilTclDict_Check(other)) && self->tclobj == ((TohilTclObj *)other)->tclobj) {
-        Py_INCREF(Py_True);
-        return Py_True;
+    if (self->done) {
+    done:
+        PyErr_SetNone(PyExc_StopIteration);
+        return NULL;
     }
 
-    char *selfString = Tcl_GetString(self->tclobj);
-
-    char *otherString = NULL;
-    Tcl_Obj *otherObj = NULL;
-    if (TohilTclObj_Check(other) || TohilTclDict_Check(other)) {
-        otherString = Tcl_GetString(((TohilTclObj *)other)->tclobj);
+    if (self->started == 0) {
+        self->started = 1;
+        // substitute &valueObj for NULL below if you also want the value
+        if (Tcl_DictObjFirst(tcl_interp, self->dictObj, &self->search, &keyObj, &valueObj, &done) == TCL_ERROR) {
+            PyErr_Format(PyExc_TypeError, "tclobj contents cannot be converted into a td");
+            return NULL;
+        }
     } else {
-        otherObj = pyObjToTcl(self->interp, other);
-        otherString = Tcl_GetString(otherObj);
+        // not the first time though, get the next entry
+        Tcl_DictObjNext(&self->search, &keyObj, &valueObj, &done);
     }
 
-    int cmp = strcmp(selfString, otherString);
-    int res = 0;
+    if (done) {
+        Tcl_DictObjDone(&self->search);
+        self->done = 1;
+        Tcl_DecrRefCount(self->dictObj);
+        self->dictObj = NULL;
+        Py_XDECREF(self->to);
+        self->to = NULL;
+        goto done;
+    }
 
-    switch (op) {
-    case Py_LT:
-        res = (cmp < 0);
-        break;
+    if (self->to == NULL) {
+        return tohil_TclObjToPyString(keyObj);
+    }
 
-    case Py_LE:
-        res = (cmp <= 0);
-        break;
+    // they specified a to, return a tuple
+    PyObject *pKey = tohil_TclObjToPyString(keyObj);
+    if (pKey == NULL) {
+        return NULL;
+    }
+    PyObject *pRetTuple = PyTuple_New(2);
+    PyTuple_SET_ITEM(pRetTuple, 0, pKey);
 
-    case Py_EQ:
-        res = (cmp == 0);
-        break;
+    PyTuple_SET_ITEM(pRetTuple, 1, tohil_python_return(tcl_interp, TCL_OK, self->to, valueObj));
 
-    case Py_NE:
-        res = (cmp != 0);
-        break;
+    return pRetTuple;
+}
 
-    case Py_GT:
-        res = (cmp > 0);
-        break;
+static PyTypeObject PyTohil_TD_IterType = {
+    .tp_name = "tohil._td_iter",
+    .tp_basicsize = sizeof(PyTohil_TD_IterObj),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "tohil TD iterator object",
+    .tp_iter = (getiterfunc)PyTohil_TD_iter,
+    .tp_iternext = (iternextfunc)PyTohil_TD_iternext,
+};
 
-    case Py_GE:
-        res = (cmp >= 0);
-        break;
+//
+//
+// end of tclobj td_iterator python datatype
+//
+//
 
-    default:
-        assert(0 == 1);
-    }
-    if (otherObj != NULL) {
-        Tcl_DecrRefCount(otherObj);
+//
+// TohilTclObj_getto - get "to" value, settable attribute for what
+//   type to convert tclobjs and tcldicts to
+//
+static PyObject *
+TohilTclObj_getto(TohilTclObj *self, void *closure)
+{
+    if (self->to == NULL) {
+        Py_RETURN_NONE;
     }
-    PyObject *p = (res ? Py_True : Py_False);
-    Py_INCREF(p);
-    return p;
+    Py_INCREF(self->to);
+    return (PyObject *)self->to;
 }
 
 //
-// tclobj.reset() - reset a tclobj or tcldict to an empty tcl object
+// TohilTclObj_getto - get "to" value, attribute for what
+//   type to convert tclobjs and tcldicts to
 //
-static PyObject *
-TohilTclObj_reset(TohilTclObj *self, PyObject *pyobj)
+static int
+TohilTclObj_setto(TohilTclObj *self, PyTypeObject *toType, void *closure)
 {
-    Tcl_DecrRefCount(self->tclobj);
-    self->tclobj = Tcl_NewObj();
-    Py_XDECREF(self->to);
-    self->to = NULL;
-    Tcl_IncrRefCount(self->tclobj);
-    Py_RETURN_NONE;
+    if (!PyType_Check(toType)) {
+        return -1;
+    }
+    PyTypeObject *tmp = self->to;
+    self->to = toType;
+    Py_INCREF(toType);
+    Py_XDECREF(tmp);
+    return 0;
 }
 
+static PyGetSetDef TohilTclObj_getsetters[] = {
+    {"to", (getter)TohilTclObj_getto, (setter)TohilTclObj_setto, "python type to default returns to", NULL},
+    {"_refcount", (getter)TohilTclObj_refcount, NULL, "reference count of the embedded tcl object", NULL},
+    {"_tcltype", (getter)TohilTclObj_type, NULL, "internal tcl data type of the tcl object", NULL},
+    {NULL}};
+
 //
-// tclobj.as_int()
+// versions of the tclobj operations that look at or change the tcl
+// object that record churn and, if they could convert or change it,
+// respect exported buffers
+//
+TOHIL_TCLOBJ_OP(TohilTclObj_subscript_churn, PyObject *, TohilTclObj_subscript, "tclobj[]", 1, NULL, (TohilTclObj * self, PyObject *item), (self, item))
+TOHIL_TCLOBJ_OP(TohilTclObj_length_churn, Py_ssize_t, TohilTclObj_length, "len(tclobj)", 1, -1, (TohilTclObj * self), (self, 0))
+TOHIL_TCLOBJ_OP(TohilTclObj_item_churn, PyObject *, TohilTclObj_item, "tclobj[]", 1, NULL, (TohilTclObj * self, Py_ssize_t i), (self, i))
+TOHIL_TCLOBJ_OP(TohilTclObj_ass_item_churn, int, TohilTclObj_ass_item, "tclobj[]=", 1, -1, (TohilTclObj * self, Py_ssize_t i, PyObject *v), (self, i, v))
+TOHIL_TCLOBJ_OP(TohilTclObj_str_churn, PyObject *, TohilTclObj_str, "str(tclobj)", 0, NULL, (TohilTclObj * self), (self))
+TOHIL_TCLOBJ_OP(TohilTclObjIter_churn, PyObject *, TohilTclObjIter, "iter(tclobj)", 1, NULL, (TohilTclObj * self), (self))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_string_churn, PyObject *, TohilTclObj_as_string, "tclobj.as_str", 0, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_int_churn, PyObject *, TohilTclObj_as_int, "tclobj.as_int", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_float_churn, PyObject *, TohilTclObj_as_float, "tclobj.as_float", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_bool_churn, PyObject *, TohilTclObj_as_bool, "tclobj.as_bool", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_list_churn, PyObject *, TohilTclObj_as_list, "tclobj.as_list", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_set_churn, PyObject *, TohilTclObj_as_set, "tclobj.as_set", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_tuple_churn, PyObject *, TohilTclObj_as_tuple, "tclobj.as_tuple", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_dict_churn, PyObject *, TohilTclObj_as_dict, "tclobj.as_dict", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_byte_array_churn, PyObject *, TohilTclObj_as_byte_array, "tclobj.as_byte_array", 0, NULL, (TohilTclObj * self, PyObject *arg),
+                 (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_as_array_churn, PyObject *, TohilTclObj_as_array, "tclobj.as_array", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_incr_churn, PyObject *, TohilTclObj_incr, "tclobj.incr", 1, NULL,
+                 (TohilTclObj * self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames), (self, args, nargs, kwnames))
+TOHIL_TCLOBJ_OP(TohilTclObj_llength_churn, PyObject *, TohilTclObj_llength, "tclobj.llength", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_lindex_churn, PyObject *, TohilTclObj_lindex, "tclobj.lindex", 1, NULL,
+                 (TohilTclObj * self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames), (self, args, nargs, kwnames))
+TOHIL_TCLOBJ_OP(TohilTclObj_lappend_churn, PyObject *, TohilTclObj_lappend, "tclobj.lappend", 1, NULL, (TohilTclObj * self, PyObject *arg), (self, arg))
+TOHIL_TCLOBJ_OP(TohilTclObj_lappend_list_churn, PyObject *, TohilTclObj_lappend_list, "tclobj.lappend_list", 1, NULL, (TohilTclObj * self, PyObject *arg),
+                 (self, arg))
+
+static PyMappingMethods TohilTclObj_as_mapping = {(lenfunc)TohilTclObj_length_churn, (binaryfunc)TohilTclObj_subscript_churn, NULL};
+
+static PySequenceMethods TohilTclObj_as_sequence = {
+    .sq_length = (lenfunc)TohilTclObj_length_churn,
+    // .sq_concat = (binaryfunc)tclobj_concat,
+    // .sq_repeat = (ssizeargfunc)tclobj_repeat,
+    .sq_item = (ssizeargfunc)TohilTclObj_item_churn,
+    .sq_ass_item = (ssizeobjargproc)TohilTclObj_ass_item_churn,
+    // .sq_contains = (objobjproc)list_contains,
+    //.sq_inplace_concat = (binaryfunc)list_inplace_concat,
+    //.sq_inplace_repeat = (ssizeargfunc)list_inplace_repeat,
+};
+
 //
-static PyObject *
-TohilTclObj_as_int(TohilTclObj *self, PyObject *pyobj)
+// tclobj buffer protocol - a tclobj holding a tcl byte array exports
+//   the byte array's storage, read-only, without copying it, so
+//   memoryview(tclobj), hashlib, zlib, struct and friends see the bytes
+//   tcl has.
+//
+//   the tcl object is pinned with a reference for as long as the view
+//   exists, and if it's shared when the first view is taken, the tclobj
+//   gets a copy of its own first, so no tcl code can convert it out from
+//   under the view.  while views exist, tclobj operations that could
+//   convert or change the object raise BufferError, and tcl is handed
+//   copies.
+//
+static int
+TohilTclObj_getbuffer(TohilTclObj *self, Py_buffer *view, int flags)
 {
-    long longValue;
+    Tcl_Obj *obj = self->tclobj;
 
-    if (Tcl_GetLongFromObj(self->interp, self->tclobj, &longValue) == TCL_OK) {
-        return PyLong_FromLong(longValue);
+    // bytes python lent tcl are exported by their owner
+    if (obj->typePtr == &pyBufferObjType) {
+        if (flags & PyBUF_WRITABLE) {
+            PyErr_SetString(PyExc_BufferError, "tclobj buffers are read-only");
+            return -1;
+        }
+        if (PyObject_GetBuffer(((TohilPyBuffer *)obj->internalRep.twoPtrValue.ptr1)->view.obj, view, flags) < 0) {
+            return -1;
+        }
+        // tcl was only lent the bytes to read
+        view->readonly = 1;
+        return 0;
     }
-    PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-    return NULL;
+
+    // a pure string, or one only carrying our cached pystr, becomes a
+    // byte array without losing any rep.  like tcl, that keeps just the
+    // low byte of each character, so characters above U+00FF don't come
+    // through as they were.
+    if (obj->typePtr != tclByteArrayType && obj->typePtr != NULL && obj->typePtr != &pyStrObjType) {
+        PyErr_Format(PyExc_BufferError, "tclobj holds a tcl %s, not a byte array", obj->typePtr->name);
+        return -1;
+    }
+
+    if (self->exports == 0 && Tcl_IsShared(obj)) {
+        Tcl_DecrRefCount(obj);
+        obj = self->tclobj = Tcl_DuplicateObj(obj);
+        Tcl_IncrRefCount(obj);
+    }
+
+    int size;
+    unsigned char *bytes = Tcl_GetByteArrayFromObj(obj, &size);
+    if (PyBuffer_FillInfo(view, (PyObject *)self, bytes, size, 1, flags) < 0) {
+        return -1;
+    }
+
+    Tcl_IncrRefCount(obj);
+    view->internal = obj;
+    self->exports++;
+    return 0;
+}
+
+static void
+TohilTclObj_releasebuffer(TohilTclObj *self, Py_buffer *view)
+{
+    Tcl_DecrRefCount((Tcl_Obj *)view->internal);
+    self->exports--;
 }
 
+static PyBufferProcs TohilTclObj_as_buffer = {
+    .bf_getbuffer = (getbufferproc)TohilTclObj_getbuffer,
+    .bf_releasebuffer = (releasebufferproc)TohilTclObj_releasebuffer,
+};
+
+static PyMethodDef TohilTclObj_methods[] = {
+    {"__getitem__", (PyCFunction)TohilTclObj_subscript_churn, METH_O | METH_COEXIST, "x.__getitem__(y) <==> x[y]"},
+    {"reset", (PyCFunction)TohilTclObj_reset, METH_NOARGS, "reset the tclobj"},
+    {"as_str", (PyCFunction)TohilTclObj_as_string_churn, METH_NOARGS, "return tclobj as str"},
+    {"as_int", (PyCFunction)TohilTclObj_as_int_churn, METH_NOARGS, "return tclobj as int"},
+    {"as_float", (PyCFunction)TohilTclObj_as_float_churn, METH_NOARGS, "return tclobj as float"},
+    {"as_bool", (PyCFunction)TohilTclObj_as_bool_churn, METH_NOARGS, "return tclobj as bool"},
+    {"as_list", (PyCFunction)TohilTclObj_as_list_churn, METH_NOARGS, "return tclobj as list"},
+    {"as_set", (PyCFunction)TohilTclObj_as_set_churn, METH_NOARGS, "return tclobj as set"},
+    {"as_tuple", (PyCFunction)TohilTclObj_as_tuple_churn, METH_NOARGS, "return tclobj as tuple"},
+    {"as_dict", (PyCFunction)TohilTclObj_as_dict_churn, METH_NOARGS, "return tclobj as dict"},
+    {"as_tclobj", (PyCFunction)TohilTclObj_as_tclobj, METH_NOARGS, "return tclobj as tclobj"},
+    {"as_tcldict", (PyCFunction)TohilTclObj_as_tcldict, METH_NOARGS, "return tclobj as tcldict"},
+    {"as_byte_array", (PyCFunction)TohilTclObj_as_byte_array_churn, METH_NOARGS, "return tclobj as a byte array"},
+    {"as_array", (PyCFunction)TohilTclObj_as_array_churn, METH_O, "return tclobj, a list of numbers, as an array.array of the given typecode"},
+    {"from_buffer", (PyCFunction)TohilTclObj_from_buffer, METH_O | METH_STATIC, "make a tclobj list of the numbers in a buffer, like an array.array"},
+    {"incr", (PyCFunction)(void (*)(void))TohilTclObj_incr_churn, METH_FASTCALL | METH_KEYWORDS, "increment tclobj as int"},
+    {"llength", (PyCFunction)TohilTclObj_llength_churn, METH_NOARGS, "length of tclobj tcl list"},
+    {"getvar", (PyCFunction)TohilTclObj_getvar, METH_O, "set tclobj to tcl var or array element"},
+    {"setvar", (PyCFunction)TohilTclObj_setvar, METH_O, "set tcl var or array element to tclobj's tcl object"},
+    {"set", (PyCFunction)TohilTclObj_set, METH_O, "set tclobj from some python object"},
+    {"lindex", (PyCFunction)(void (*)(void))TohilTclObj_lindex_churn, METH_FASTCALL | METH_KEYWORDS, "get value from tclobj as tcl list"},
+    {"lappend", (PyCFunction)TohilTclObj_lappend_churn, METH_O, "lappend (list-append) something to tclobj"},
+    {"lappend_list", (PyCFunction)TohilTclObj_lappend_list_churn, METH_O, "lappend another tclobj or a python list of stuff to tclobj"},
+    {NULL} // sentinel
+};
+
+static PyTypeObject TohilTclObjType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "tohil.tclobj",
+    .tp_doc = "Tcl Object",
+    .tp_basicsize = sizeof(TohilTclObj),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_new = TohilTclObj_new,
+    .tp_init = (initproc)TohilTclObj_init,
+#ifdef TOHIL_VECTORCALL
+    .tp_vectorcall = TohilTclObj_vectorcall_new,
+#endif
+    .tp_dealloc = (destructor)TohilTclObj_dealloc,
+    .tp_methods = TohilTclObj_methods,
+    .tp_str = (reprfunc)TohilTclObj_str_churn,
+    .tp_iter = (getiterfunc)TohilTclObjIter_churn,
+    .tp_as_sequence = &TohilTclObj_as_sequence,
+    .tp_as_mapping = &TohilTclObj_as_mapping,
+    .tp_as_buffer = &TohilTclObj_as_buffer,
+    .tp_repr = (reprfunc)TohilTclObj_repr,
+    .tp_richcompare = (richcmpfunc)TohilTclObj_richcompare,
+    .tp_getset = TohilTclObj_getsetters,
+};
+
+//
+// end of tclobj python datatype
+//
+
 //
-// tclobj.as_float()
+// start of tcldict python datatype
 //
-static PyObject *
-TohilTclObj_as_float(TohilTclObj *self, PyObject *pyobj)
-{
-    double doubleValue;
 
-    if (Tcl_GetDoubleFromObj(self->interp, self->tclobj, &doubleValue) == TCL_OK) {
-        return PyFloat_FromDouble(doubleValue);
-    }
-    PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-    return NULL;
-}
+// the object's python data structure is the same as tclobj
+// so we can reuse that to the max.  we're going to have different
+// iterators and stuff for dicts
 
 //
-// tclobj.as_bool()
+// return true if python object is a tclobj type
 //
-static PyObject *
-TohilTclObj_as_bool(TohilTclObj *self, PyObject *pyobj)
+int
+TohilTclDict_Check(PyObject *pyObj)
 {
-    int intValue;
-    if (Tcl_GetBooleanFromObj(self->interp, self->tclobj, &intValue) == TCL_OK) {
-        PyObject *p = (intValue ? Py_True : Py_False);
-        Py_INCREF(p);
-        return p;
-    }
-    PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-    return NULL;
+    return PyObject_TypeCheck(pyObj, &TohilTclDictType);
 }
 
 //
-// tclobj.as_string()
+// create a new python tcldict object from any Tcl_Obj
 //
 static PyObject *
-TohilTclObj_as_string(TohilTclObj *self, PyObject *pyobj)
+TohilTclDict_FromTclObj(Tcl_Obj *obj)
 {
-    int tclStringSize;
-    char *tclString = Tcl_GetStringFromObj(self->tclobj, &tclStringSize);
-
-    int utf8len;
-    char *utf8string;
-    if (tohil_TclToUTF8(tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-        return NULL;
+    TohilTclObj *self = (TohilTclObj *)TohilTclDictType.tp_alloc(&TohilTclDictType, 0);
+    if (self != NULL) {
+        self->interp = tcl_interp;
+        self->tclobj = obj;
+        Tcl_IncrRefCount(obj);
     }
-    PyObject *pObj = Py_BuildValue("s#", utf8string, utf8len);
-    ckfree(utf8string);
-    return pObj;
+    return (PyObject *)self;
 }
 
 //
-// tclobj.as_list()
+// td - tcl dict stuff
 //
-static PyObject *
-TohilTclObj_as_list(TohilTclObj *self, PyObject *pyobj)
-{
-    return tclListObjToPyListObject(self->interp, self->tclobj);
-}
 
 //
-// tclobj.as_set()
-//
-static PyObject *
-TohilTclObj_as_set(TohilTclObj *self, PyObject *pyobj)
-{
-    return tclListObjToPySetObject(self->interp, self->tclobj);
-}
-
+// td_locate(key) - do a dict get on the tclobj object using
+//   either a list of keys or a singleton key, and return
+//   the target value object.
 //
-// tclobj.as_tuple()
+//   internal routine used by td_get and td_exists
 //
-static PyObject *
-TohilTclObj_as_tuple(TohilTclObj *self, PyObject *pyobj)
+static Tcl_Obj *
+TohilTclDict_td_locate(TohilTclObj *self, PyObject *keys)
 {
-    return tclListObjToPyTupleObject(self->interp, self->tclobj);
+    // printf("TohilTclDict_td_locate\n");
+    Tcl_Obj *keyObj = NULL;
+    Tcl_Obj *valueObj = NULL;
+
+    if (PyList_Check(keys)) {
+        int i;
+        Tcl_Obj *dictPtrObj = self->tclobj;
+        Py_ssize_t nKeys = PyList_GET_SIZE(keys);
+
+        for (i = 0; i < nKeys; i++) {
+            PyObject *keyPyObj = PyList_GET_ITEM(keys, i);
+            keyObj = pyObjToTcl(self->interp, keyPyObj);
+
+            if (Tcl_DictObjGet(self->interp, dictPtrObj, keyObj, &valueObj) == TCL_ERROR) {
+                Tcl_DecrRefCount(keyObj);
+                PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
+                return NULL;
+            }
+            if (valueObj == NULL) {
+                Tcl_DecrRefCount(keyObj);
+                return NULL;
+            }
+            dictPtrObj = valueObj;
+            Tcl_DecrRefCount(keyObj);
+        }
+
+        // at this point if there's been no error valueObj has our guy
+    } else {
+        // it's a singleton
+        Tcl_Obj *keyObj = pyObjToTcl(self->interp, keys);
+
+        if (Tcl_DictObjGet(NULL, self->tclobj, keyObj, &valueObj) == TCL_ERROR) {
+            Tcl_DecrRefCount(keyObj);
+            PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
+            return NULL;
+        }
+        Tcl_DecrRefCount(keyObj);
+    }
+
+    return valueObj;
 }
 
 //
-// tclobj.as_dict()
+// td_get(key) - do a dict get on the tcl object
 //
 static PyObject *
-TohilTclObj_as_dict(TohilTclObj *self, PyObject *pyobj)
+TohilTclDict_td_get(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    return tclListObjToPyDictObject(self->interp, self->tclobj);
+    static const char *const kwlist[] = {"key", "to", "default", NULL};
+    PyObject *values[3];
+
+    if (tohil_parse_args("get", args, nargs, kwnames, kwlist, 1, 1, values) < 0) {
+        return NULL;
+    }
+
+    PyObject *keys = values[0];
+    PyTypeObject *to = (PyTypeObject *)values[1];
+    PyObject *pDefault = values[2];
+
+    Tcl_Obj *valueObj = TohilTclDict_td_locate(self, keys);
+    if (valueObj == NULL) {
+        if (pDefault != NULL) {
+            if (to == NULL) {
+                // not there but they provided a default,
+                // give them their default
+                Py_INCREF(pDefault);
+                return pDefault;
+            } else {
+                valueObj = pyObjToTcl(self->interp, pDefault);
+            }
+        } else {
+            // not there, no default.  it's an error.
+            // this is clean and the way python does it.
+            PyErr_SetObject(PyExc_KeyError, keys);
+            return NULL;
+        }
+    }
+
+    if (to == NULL && self->to != NULL)
+        to = self->to;
+
+    return tohil_python_return(self->interp, TCL_OK, to, valueObj);
 }
 
 //
-// tclobj.as_tclobj()
+// TohilTclDict_subscript - return the value of an element in
+//   the tcl dict.  value may itself be a sub-dictionary.
+//
+//   key can be a list of keys in which case the tcl dict is
+//   treated as a hierarchy of dicts.
 //
 static PyObject *
-TohilTclObj_as_tclobj(TohilTclObj *self, PyObject *pyobj)
+TohilTclDict_subscript(TohilTclObj *self, PyObject *keys)
 {
-    return TohilTclObj_FromTclObj(self->tclobj);
+    // printf("TohilTclDict_subscript\n");
+    Tcl_Obj *valueObj = TohilTclDict_td_locate(self, keys);
+    if (valueObj == NULL) {
+        // not there, no default.  it's an error.
+        // this is clean and the way python does it.
+        PyErr_SetObject(PyExc_KeyError, keys);
+        return NULL;
+    }
+
+    return tohil_python_return(self->interp, TCL_OK, self->to, valueObj);
 }
 
 //
-// tclobj.as_tcldict()
+// TohilTclDict_delitem - removes an item from the tcldict.  if
+//   keys is a python list, treats tcl dict as a hierarchy of
+//   tcl dicts.
 //
-static PyObject *
-TohilTclObj_as_tcldict(TohilTclObj *self, PyObject *pyobj)
+static int
+TohilTclDict_delitem(TohilTclObj *self, PyObject *keys)
 {
-    return TohilTclDict_FromTclObj(self->tclobj);
+    if (PyList_Check(keys)) {
+        int objc = 0;
+        Tcl_Obj **objv = NULL;
+
+        // build up a tcl objv of the keys
+        pyListToTclObjv((PyListObject *)keys, &objc, &objv);
+
+        // we are about to try to modify the object, so if it's shared we need to copy
+        TohilTclObj_dup_if_shared(self);
+
+        int status = (Tcl_DictObjRemoveKeyList(self->interp, self->tclobj, objc, objv));
+
+        // tear down the objv of the keys we created
+        pyListToObjv_teardown(objc, objv);
+
+        if (status == TCL_ERROR) {
+            PyErr_SetString(PyExc_KeyError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+            return -1;
+        }
+    } else {
+        Tcl_Obj *keyObj = _pyObjToTcl(self->interp, keys);
+
+        if (keyObj == NULL) {
+            PyErr_SetString(PyExc_RuntimeError, "unable to fashion argument into a string to be used as a dictionary key");
+            return -1;
+        }
+
+        // we are about to try to modify the object, so if it's shared we need to copy
+        TohilTclObj_dup_if_shared(self);
+
+        if (Tcl_DictObjRemove(NULL, self->tclobj, keyObj) == TCL_ERROR) {
+            Tcl_DecrRefCount(keyObj);
+            PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
+            return -1;
+        }
+        Tcl_DecrRefCount(keyObj);
+    }
+
+    return 0;
 }
 
 //
-// tclobj.as_byte_array()
+// self.setitem(keys, value) - translates python value object to
+//   tcl and sets it in the tcldict.  if keys is a python list,
+//   treats it as a hierarchy of dictionaries.
 //
-static PyObject *
-TohilTclObj_as_byte_array(TohilTclObj *self, PyObject *pyobj)
+static int
+TohilTclDict_setitem(TohilTclObj *self, PyObject *keys, PyObject *pValue)
 {
-    int size;
-    unsigned char *byteArray = Tcl_GetByteArrayFromObj(self->tclobj, &size);
-    return PyByteArray_FromStringAndSize((const char *)byteArray, size);
-}
+    Tcl_Obj *valueObj = pyObjToTcl(self->interp, pValue);
 
-void
-TohilTclObj_dup_if_shared(TohilTclObj *self)
-{
-    if (!Tcl_IsShared(self->tclobj)) {
-        return;
+    // we are about to try to modify the object, so if it's shared we need to copy
+    TohilTclObj_dup_if_shared(self);
+
+    if (PyList_Check(keys)) {
+        int objc;
+        Tcl_Obj **objv;
+
+        // build up a tcl objv of the keys
+        pyListToTclObjv((PyListObject *)keys, &objc, &objv);
+
+        int status = (Tcl_DictObjPutKeyList(self->interp, self->tclobj, objc, objv, valueObj));
+
+        // tear down the objv of the keys we created
+        pyListToObjv_teardown(objc, objv);
+
+        if (status == TCL_ERROR) {
+            Tcl_DecrRefCount(valueObj);
+            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+            return -1;
+        }
+    } else {
+        Tcl_Obj *keyObj = _pyObjToTcl(self->interp, keys);
+
+        if (keyObj == NULL) {
+            PyErr_SetString(PyExc_RuntimeError, "unable to fashion argument into a string to be used as a dictionary key");
+            return -1;
+        }
+
+        if (Tcl_DictObjPut(self->interp, self->tclobj, keyObj, valueObj) == TCL_ERROR) {
+            Tcl_DecrRefCount(keyObj);
+            Tcl_DecrRefCount(valueObj);
+            PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
+            return -1;
+        }
+        // something about this is a crash
+        // Tcl_DecrRefCount(keyObj);
+        // Tcl_DecrRefCount(valueObj);
     }
 
-    // decrement the old object.  It's safe because refcount
-    // must be 2 or more.  then duplicate and increment
-    // the new, duplicated object's 0 refcount to 1
-    Tcl_DecrRefCount(self->tclobj);
-    self->tclobj = Tcl_DuplicateObj(self->tclobj);
-    Tcl_IncrRefCount(self->tclobj);
+    return 0;
 }
 
 //
-// tclobj.incr() - increment a python tclobj object
+// tclobj.td_set(key, value) - do a dict set on the tcl object.
+//   if key is a python list, td_set operates on a nested hierarchy
+//   of dictionaries.
 //
 static PyObject *
-TohilTclObj_incr(TohilTclObj *self, PyObject *args, PyObject *kwargs)
+TohilTclDict_td_set(TohilTclObj *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"incr", NULL};
-    long longValue = 0;
-    long increment = 1;
+    static const char *const kwlist[] = {"key", "value", NULL};
+    PyObject *values[2];
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|l", kwlist, &increment)) {
+    // remember, these are borrowed references
+    if (tohil_parse_args("td_set", args, nargs, kwnames, kwlist, 2, 2, values) < 0) {
         return NULL;
     }
 
-    if (Tcl_GetLongFromObj(self->interp, self->tclobj, &longValue) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    PyObject *keys = values[0];
+    PyObject *pValue = values[1];
+
+    if (TohilTclDict_setitem(self, keys, pValue) < 0) {
         return NULL;
     }
 
-    longValue += increment;
-
-    TohilTclObj_dup_if_shared(self);
-    Tcl_SetLongObj(self->tclobj, longValue);
-    return PyLong_FromLong(longValue);
+    Py_RETURN_NONE;
 }
 
 //
-// convert a python list into a tcl c-level objv and objc
+// TohilTclDict_ass_sub() - if a python key object and python value
+//   object are present, set in the tcl dict for the key, the value.
 //
-// pyListToTclObjv(pList, &objc, &objv);
+//   the key may be a list in which case the dictionary is a hierarchy
+//   of dictionaries.
 //
-// you must call pyListToObjv_teardown when done or you'll
-// leak memory
+//   if the value is NULL then deletes the item.
 //
-static void
-pyListToTclObjv(PyListObject *pList, int *intPtr, Tcl_Obj ***objvPtr)
+static int
+TohilTclDict_ass_sub(TohilTclObj *self, PyObject *key, PyObject *val)
 {
-    int i;
-
-    assert(PyList_Check(pList));
-    Py_ssize_t objc = PyList_GET_SIZE(pList);
-    // build up a tcl objv of the list elements
-    Tcl_Obj **objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
-    for (i = 0; i < objc; i++) {
-        objv[i] = pyObjToTcl(tcl_interp, PyList_GET_ITEM(pList, i));
-        Tcl_IncrRefCount(objv[i]);
+    if (val == NULL) {
+        return TohilTclDict_delitem(self, key);
+    } else {
+        return TohilTclDict_setitem(self, key, val);
     }
-    *objvPtr = objv;
-    *intPtr = objc;
 }
 
 //
-// teardown an objv created by pyListToObjv
+// TohilTclDict_length() - return the dict size of a python tcldict's
+//   tcl object or set a python error and return -1 if something went wrong.
 //
-static void
-pyListToObjv_teardown(int objc, Tcl_Obj **objv)
+static Py_ssize_t
+TohilTclDict_length(TohilTclObj *self)
 {
-    int i;
-
-    // tear down the objv of the keys we created
-    for (i = 0; i < objc; i++) {
-        Tcl_DecrRefCount(objv[i]);
+    int length;
+    if (Tcl_DictObjSize(self->interp, self->tclobj, &length) == TCL_OK) {
+        return length;
     }
-    ckfree(objv);
+    PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
+    return -1;
 }
 
 //
-// llength - return the length of a python tclobj's tcl object
-//   as a list.  exception thrown if tcl object isn't a list
+// TohilTclDict_size() - return a python object containing the dict size
+//   of a python tcldict's tcl object.
+//   returns null i.e. exception thrown if tcl object isn't a proper tcl dict.
 //
 static PyObject *
-TohilTclObj_llength(TohilTclObj *self, PyObject *pyobj)
+TohilTclDict_size(TohilTclObj *self, PyObject *dummy)
 {
-    int length;
-    if (Tcl_ListObjLength(self->interp, self->tclobj, &length) == TCL_OK) {
-        return PyLong_FromLong(length);
+    int length = TohilTclDict_length(self);
+    if (length < 0) {
+        return NULL;
     }
-    PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-    return NULL;
+    return PyLong_FromLong(length);
 }
 
 //
-// getvar - set python tclobj to contain the value of a tcl var
+// TohilTclDictIter() - returns a tcldict iterator object that can
+//   iterate over a tcldict.
 //
 static PyObject *
-TohilTclObj_getvar(TohilTclObj *self, PyObject *var)
+TohilTclDictIter(TohilTclObj *self)
 {
-    char *varString = (char *)PyUnicode_1BYTE_DATA(var);
-    Tcl_Obj *newObj = Tcl_GetVar2Ex(self->interp, varString, NULL, (TCL_LEAVE_ERR_MSG));
-    if (newObj == NULL) {
-        PyErr_SetString(PyExc_NameError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    // printf("TohilTclDictIter\n");
+    // we don't need size but we use this to make tclobj is or can be a dict
+    int size = 0;
+    if (Tcl_DictObjSize(self->interp, self->tclobj, &size) == TCL_ERROR) {
+        PyErr_Format(PyExc_TypeError, "tclobj contents cannot be converted into a td");
         return NULL;
     }
-    Tcl_DecrRefCount(self->tclobj);
-    self->tclobj = newObj;
-    Tcl_IncrRefCount(self->tclobj);
-    Py_RETURN_NONE;
+
+    PyTohil_TD_IterObj *pIter = (PyTohil_TD_IterObj *)PyObject_New(PyTohil_TD_IterObj, &PyTohil_TD_IterType);
+
+    pIter->interp = self->interp;
+    pIter->started = 0;
+    pIter->done = 0;
+    pIter->to = self->to;
+    Py_XINCREF(pIter->to);
+
+    memset((void *)&pIter->search, 0, sizeof(Tcl_DictSearch));
+
+    pIter->dictObj = ((TohilTclObj *)self)->tclobj;
+    Tcl_IncrRefCount(pIter->dictObj);
+
+    return (PyObject *)pIter;
 }
 
 //
-// setvar - set set tcl var to point to the tcl object of a python tclobj
+// TohilTclDict_Contains - return 0 if key or keys is not
+//   contained in tcldict, 1 if it is, or -1 if there was
+//   an error.
 //
-static PyObject *
-TohilTclObj_setvar(TohilTclObj *self, PyObject *var)
+static int
+TohilTclDict_Contains(PyObject *self, PyObject *keys)
 {
-    char *varString = (char *)PyUnicode_1BYTE_DATA(var);
-    // setvar handles incrementing the reference count
-    if (Tcl_SetVar2Ex(self->interp, varString, NULL, self->tclobj, (TCL_LEAVE_ERR_MSG)) == NULL) {
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-        return NULL;
+    // printf("TohilTclDict_Contains\n");
+    Tcl_Obj *valueObj = TohilTclDict_td_locate((TohilTclObj *)self, keys);
+    if (valueObj == NULL) {
+        if (PyErr_Occurred() != NULL) {
+            return -1;
+        }
+        return 0;
     }
-    Py_RETURN_NONE;
+    return 1;
 }
 
 //
-// set - tclobj type set method can set an object to a lot
-// of possible python stuff -- NB there must be a better way
+// churn-recording versions of the tcldict operations.  tcldicts don't
+// export buffers.
 //
-static PyObject *
-TohilTclObj_set(TohilTclObj *self, PyObject *pyObject)
-{
-    Tcl_Obj *newObj = pyObjToTcl(self->interp, pyObject);
-    if (newObj == NULL) {
-        return NULL;
-    }
-    Tcl_DecrRefCount(self->tclobj);
-    self->tclobj = newObj;
-    Tcl_IncrRefCount(self->tclobj);
+TOHIL_TCLOBJ_OP(TohilTclDict_subscript_churn, PyObject *, TohilTclDict_subscript, "tcldict[]", 0, NULL, (TohilTclObj * self, PyObject *keys), (self, keys))
+TOHIL_TCLOBJ_OP(TohilTclDict_ass_sub_churn, int, TohilTclDict_ass_sub, "tcldict[]=", 0, -1, (TohilTclObj * self, PyObject *key, PyObject *val),
+                 (self, key, val))
+TOHIL_TCLOBJ_OP(TohilTclDict_length_churn, Py_ssize_t, TohilTclDict_length, "len(tcldict)", 0, -1, (TohilTclObj * self), (self))
+TOHIL_TCLOBJ_OP(TohilTclDict_size_churn, PyObject *, TohilTclDict_size, "len(tcldict)", 0, NULL, (TohilTclObj * self, PyObject *dummy), (self, dummy))
+TOHIL_TCLOBJ_OP(TohilTclDict_Contains_churn, int, TohilTclDict_Contains, "in tcldict", 0, -1, (PyObject * self, PyObject *keys), (self, keys))
+TOHIL_TCLOBJ_OP(TohilTclDictIter_churn, PyObject *, TohilTclDictIter, "iter(tcldict)", 0, NULL, (TohilTclObj * self), (self))
+TOHIL_TCLOBJ_OP(TohilTclDict_td_get_churn, PyObject *, TohilTclDict_td_get, "tcldict.get", 0, NULL,
+                 (TohilTclObj * self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames), (self, args, nargs, kwnames))
+TOHIL_TCLOBJ_OP(TohilTclDict_td_set_churn, PyObject *, TohilTclDict_td_set, "tcldict.td_set", 0, NULL,
+                 (TohilTclObj * self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames), (self, args, nargs, kwnames))
 
-    Py_RETURN_NONE;
-}
+static PyMappingMethods TohilTclDict_as_mapping = {(lenfunc)TohilTclDict_length_churn, (binaryfunc)TohilTclDict_subscript_churn,
+                                                   (objobjargproc)TohilTclDict_ass_sub_churn};
+
+static PySequenceMethods TohilTclDict_as_sequence = {
+    .sq_contains = TohilTclDict_Contains_churn,
+};
+
+static PyMethodDef TohilTclDict_methods[] = {
+    {"get", (PyCFunction)(void (*)(void))TohilTclDict_td_get_churn, METH_FASTCALL | METH_KEYWORDS, "get from tcl dict"},
+    // NB i don't know if this __len__ thing works -- python might
+    // be doing something gross to get the len of the dict, like
+    // enumerating the elements
+    {"__len__", (PyCFunction)TohilTclDict_size_churn, METH_NOARGS, "get length of tcl dict"},
+    {"td_set", (PyCFunction)(void (*)(void))TohilTclDict_td_set_churn, METH_FASTCALL | METH_KEYWORDS, "set item in tcl dict"},
+    {"getvar", (PyCFunction)TohilTclObj_getvar, METH_O, "set tclobj to tcl var or array element"},
+    {"setvar", (PyCFunction)TohilTclObj_setvar, METH_O, "set tcl var or array element to tclobj's tcl object"},
+    {"set", (PyCFunction)TohilTclObj_set, METH_O, "set tclobj from some python object"},
+    {NULL} // sentinel
+};
+
+// NB need to change tp_itr, to_as_squence, to_as_mapping to do dict stuff
+
+static PyTypeObject TohilTclDictType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+        // .tp_base = &TohilTclObjType, NB - len() breaks when we inherit
+        .tp_name = "tohil.tcldict",
+    .tp_doc = "Tcl TD tcldict Object",
+    .tp_basicsize = sizeof(TohilTclObj),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_new = TohilTclObj_new,
+    .tp_init = (initproc)TohilTclObj_init,
+#ifdef TOHIL_VECTORCALL
+    .tp_vectorcall = TohilTclObj_vectorcall_new,
+#endif
+    .tp_dealloc = (destructor)TohilTclObj_dealloc,
+    .tp_methods = TohilTclDict_methods,
+    .tp_str = (reprfunc)TohilTclObj_str_churn,
+    .tp_iter = (getiterfunc)TohilTclDictIter_churn,
+    .tp_as_mapping = &TohilTclDict_as_mapping,
+    .tp_as_sequence = &TohilTclDict_as_sequence,
+    .tp_repr = (reprfunc)TohilTclObj_repr,
+    .tp_richcompare = (richcmpfunc)TohilTclObj_richcompare,
+    .tp_getset = TohilTclObj_getsetters,
+};
 
 //
-// lindex - obtain the n'th element of tclobj as a tcl list.
 //
-// to=type can be used to control what python type is returned.
+// end of tcldict python datatype
+//
+//
+
+//
+//
+// to= conversions
+//
+//
+
+//
+// a converter turns a tcl object into a python object of one particular
+// type.  C extensions can supply their own by registering a PyCapsule
+// named "tohil.converter" wrapping a function of this type.
 //
+typedef PyObject *(*tohil_converter_func)(Tcl_Interp *interp, Tcl_Obj *obj);
+
 static PyObject *
-TohilTclObj_lindex(TohilTclObj *self, PyObject *args, PyObject *kwargs)
+tohil_to_str(Tcl_Interp *interp, Tcl_Obj *obj)
 {
-    static char *kwlist[] = {"index", "to", NULL};
-    PyTypeObject *to = NULL;
-    int index = 0;
-    int length = 0;
+    return tohil_TclObjToPyString(obj);
+}
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i|$O", kwlist, &index, &to))
-        return NULL;
+static PyObject *
+tohil_to_int(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    PyObject *pLong = tohil_TclObjToPyLong(interp, obj);
 
-    if (Tcl_ListObjLength(self->interp, self->tclobj, &length) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-        return NULL;
+    if (pLong == NULL && !PyErr_Occurred()) {
+        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
     }
+    return pLong;
+}
 
-    if (index < 0 || index >= length) {
-        PyErr_SetString(PyExc_IndexError, "list index out of range");
-        return NULL;
+static PyObject *
+tohil_to_bool(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    int boolValue;
+
+    if (Tcl_GetBooleanFromObj(interp, obj, &boolValue) == TCL_OK) {
+        PyObject *p = (boolValue ? Py_True : Py_False);
+        Py_INCREF(p);
+        return p;
     }
+    PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+    return NULL;
+}
 
-    Tcl_Obj *resultObj = NULL;
-    if (Tcl_ListObjIndex(self->interp, self->tclobj, index, &resultObj) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-        return NULL;
+static PyObject *
+tohil_to_float(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    double doubleValue;
+
+    if (Tcl_GetDoubleFromObj(interp, obj, &doubleValue) == TCL_OK) {
+        return PyFloat_FromDouble(doubleValue);
     }
+    PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+    return NULL;
+}
 
-    if (to == NULL && self->to != NULL)
-        to = self->to;
+static PyObject *
+tohil_to_tclobj(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    return TohilTclObj_FromTclObj(obj);
+}
 
-    return tohil_python_return(self->interp, TCL_OK, to, resultObj);
+static PyObject *
+tohil_to_tcldict(Tcl_Interp *interp, Tcl_Obj *obj)
+{
+    return TohilTclDict_FromTclObj(obj);
 }
 
 //
-// lappend something to the tclobj
+// tohil.auto is only ever used as a to= value, asking for the python
+// type to be picked from what the tcl object already is
+//
+static PyTypeObject TohilAutoType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "tohil.auto",
+    .tp_doc = "to= conversion choosing the python type from the tcl object's internal representation",
+    .tp_basicsize = sizeof(PyObject),
+    .tp_itemsize = 0,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+};
+
+//
+// the built-in to= types, most commonly asked for first.  the type
+// pointers are filled in by tohil_init_converters at module init.
 //
-static PyObject *
-TohilTclObj_lappend(TohilTclObj *self, PyObject *pObject)
-{
-    Tcl_Obj *newObj = pyObjToTcl(self->interp, pObject);
-    if (newObj == NULL) {
-        return NULL;
-    }
+#define TOHIL_N_BUILTIN_CONVERTERS 11
 
-    // we are about to modify the object so if it's shared we need to copy
-    // NB i think we don't increment here because ListObjAppendElement
-    // will do it for us.
-    if (Tcl_IsShared(self->tclobj)) {
-        Tcl_DecrRefCount(self->tclobj);
-        self->tclobj = Tcl_DuplicateObj(self->tclobj);
-    }
+static struct {
+    PyTypeObject *type;
+    tohil_converter_func func;
+    TohilChurnSite churnSite;
+} tohil_builtin_converters[TOHIL_N_BUILTIN_CONVERTERS];
 
-    if (Tcl_ListObjAppendElement(self->interp, self->tclobj, newObj) == TCL_ERROR) {
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-        Tcl_DecrRefCount(newObj);
-        return NULL;
-    }
-    // it worked
-    Py_RETURN_NONE;
+// dict of type -> capsule or python callable, see tohil.register_converter
+static PyObject *tohil_converters = NULL;
+
+static int
+tohil_init_converters(void)
+{
+    int i = 0;
+
+#define TOHIL_BUILTIN_CONVERTER(typePtr, fn, siteName) \
+    tohil_builtin_converters[i].type = (typePtr);   \
+    tohil_builtin_converters[i].churnSite.name = (siteName); \
+    tohil_builtin_converters[i++].func = (fn)
+
+    TOHIL_BUILTIN_CONVERTER(&PyUnicode_Type, tohil_to_str, "to=str");
+    TOHIL_BUILTIN_CONVERTER(&PyLong_Type, tohil_to_int, "to=int");
+    TOHIL_BUILTIN_CONVERTER(&PyFloat_Type, tohil_to_float, "to=float");
+    TOHIL_BUILTIN_CONVERTER(&PyBool_Type, tohil_to_bool, "to=bool");
+    TOHIL_BUILTIN_CONVERTER(&TohilTclObjType, tohil_to_tclobj, "to=tohil.tclobj");
+    TOHIL_BUILTIN_CONVERTER(&TohilTclDictType, tohil_to_tcldict, "to=tohil.tcldict");
+    TOHIL_BUILTIN_CONVERTER(&PyList_Type, tclListObjToPyListObject, "to=list");
+    TOHIL_BUILTIN_CONVERTER(&PyTuple_Type, tclListObjToPyTupleObject, "to=tuple");
+    TOHIL_BUILTIN_CONVERTER(&PyDict_Type, tclListObjToPyDictObject, "to=dict");
+    TOHIL_BUILTIN_CONVERTER(&PySet_Type, tclListObjToPySetObject, "to=set");
+    TOHIL_BUILTIN_CONVERTER(&TohilAutoType, tclObjToPyAuto, "to=tohil.auto");
+
+#undef TOHIL_BUILTIN_CONVERTER
+    assert(i == TOHIL_N_BUILTIN_CONVERTERS);
+
+    tohil_converters = PyDict_New();
+    return (tohil_converters == NULL) ? -1 : 0;
 }
 
 //
-// lappend_list, lappend a list of something to the tclobj
-//
-// if append object is a tclobj and the tclobj contents can be
-// treated as a list, it will be appended as the list
+// tohil.register_converter(type, fn) - make fn the to= conversion for type.
 //
-// if append object is a python list then its contents will be
-// appended to the list while being converted to tcl objects
+// fn is either a python callable, which is passed the result as a tclobj
+// and returns the converted value, or a PyCapsule named "tohil.converter"
+// holding a tohil_converter_func.  fn of None removes a registration.
+// the built-in conversions can't be replaced.
 //
 static PyObject *
-TohilTclObj_lappend_list(TohilTclObj *self, PyObject *pObject)
+tohil_register_converter(PyObject *m, PyObject *const *args, Py_ssize_t nargs)
 {
+    if (nargs != 2) {
+        PyErr_Format(PyExc_TypeError, "register_converter() takes exactly 2 arguments (%zd given)", nargs);
+        return NULL;
+    }
+    PyObject *type = args[0];
+    PyObject *fn = args[1];
 
-    // if passed python object is a tclobj, use tcl list C stuff
-    // to append the list to the list
-    if (TohilTclObj_Check(pObject)) {
-        Tcl_Obj *appendListObj = ((TohilTclObj *)pObject)->tclobj;
-
-        // NB i think we don't increment here because ListObjAppendList
-        // will do it for us.
-        if (Tcl_IsShared(self->tclobj)) {
-            Tcl_DecrRefCount(self->tclobj);
-            self->tclobj = Tcl_DuplicateObj(self->tclobj);
-        }
+    if (!PyType_Check(type)) {
+        PyErr_Format(PyExc_TypeError, "register_converter() argument 1 must be a type, not %.200s", Py_TYPE(type)->tp_name);
+        return NULL;
+    }
 
-        if (Tcl_ListObjAppendList(self->interp, self->tclobj, appendListObj) == TCL_ERROR) {
-            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-            Tcl_DecrRefCount(appendListObj);
+    for (int i = 0; i < TOHIL_N_BUILTIN_CONVERTERS; i++) {
+        if (tohil_builtin_converters[i].type == (PyTypeObject *)type) {
+            PyErr_Format(PyExc_ValueError, "the built-in conversion to %.200s can't be replaced", ((PyTypeObject *)type)->tp_name);
             return NULL;
         }
-        // if passed python object is a python list, use that and our
-        // python-to-tcl stuff to make a tcl list of it, and append
-        // that list to the tclobj's object, which is a list or an error
-        // is forthcoming
-    } else if (PyList_Check(pObject)) {
-        int objc;
-        Tcl_Obj **objv = NULL;
-
-        pyListToTclObjv((PyListObject *)pObject, &objc, &objv);
-        Tcl_Obj *appendListObj = Tcl_NewListObj(objc, objv);
-        pyListToObjv_teardown(objc, objv);
+    }
 
-        if (Tcl_IsShared(self->tclobj)) {
-            Tcl_DecrRefCount(self->tclobj);
-            self->tclobj = Tcl_DuplicateObj(self->tclobj);
+    if (fn == Py_None) {
+        if (PyDict_DelItem(tohil_converters, type) < 0) {
+            if (!PyErr_ExceptionMatches(PyExc_KeyError)) {
+                return NULL;
+            }
+            PyErr_Clear();
         }
+        Py_RETURN_NONE;
+    }
 
-        if (Tcl_ListObjAppendList(self->interp, self->tclobj, appendListObj) == TCL_ERROR) {
-            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-            Tcl_DecrRefCount(appendListObj);
+    if (PyCapsule_CheckExact(fn)) {
+        if (!PyCapsule_IsValid(fn, "tohil.converter")) {
+            PyErr_SetString(PyExc_ValueError, "converter capsule must be named \"tohil.converter\"");
             return NULL;
         }
-    } else {
-        PyErr_Format(PyExc_TypeError, "lappend_list argument must be a tclobj or list, not %.200s", Py_TYPE(pObject)->tp_name);
+    } else if (!PyCallable_Check(fn)) {
+        PyErr_Format(PyExc_TypeError, "converter must be callable, a tohil.converter capsule or None, not %.200s", Py_TYPE(fn)->tp_name);
         return NULL;
     }
 
-    // it worked
+    if (PyDict_SetItem(tohil_converters, type, fn) < 0) {
+        return NULL;
+    }
     Py_RETURN_NONE;
 }
 
 //
-// TohilTclObj_refcount - return the reference count of the
-//   tclobj or tcldict's internal tcl object
-//
-static PyObject *
-TohilTclObj_refcount(TohilTclObj *self, PyObject *dummy)
-{
-    return PyLong_FromLong(self->tclobj->refCount);
-}
-
+// tohil_python_return - you call this routine when you have a tcl object
+//   that you want to turn into a python object.  usually you call it when
+//   you are returning from a C function called from python, but it is
+//   used repeatedly in TohilTclObj_slice to prepare a list of python objects
+//   converted from tcl objects.
 //
-// TohilTclObj_type - return the internal tcl data type of
-//   the corresponding tclobj/tcldict python type
+//   this code is called  a lot.  it also can return tcl errors, and it
+//   can convert the tcl object to a specific python type if the "to" type
+//   is not null.  (If null the conversion type defaults to str.)
 //
-//   this can use useful but it's not canonical - the type
-//   may not have been set to anything if the string therein
-//   hasn't been used as a list, dict, etc.
+//   to= is looked up by type pointer, first in the built-in table, then
+//   in the converters registered with tohil.register_converter.
 //
-static PyObject *
-TohilTclObj_type(TohilTclObj *self, PyObject *dummy)
+PyObject *
+tohil_python_return(Tcl_Interp *interp, int tcl_result, PyTypeObject *toType, Tcl_Obj *resultObj)
 {
-    const Tcl_ObjType *typePtr = self->tclobj->typePtr;
-    if (typePtr == NULL) {
-        Py_RETURN_NONE;
+    if (PyErr_Occurred() != NULL) {
+        // printf("tohil_python_return invoked with a python error already present\n");
+        // return NULL;
     }
-    return Py_BuildValue("s", self->tclobj->typePtr->name);
-}
 
-static PyObject *
-TohilTclObjIter(PyObject *self)
-{
-    assert(tohilTclObjIterator != NULL);
-    PyObject *pyRet = PyObject_CallFunction(tohilTclObjIterator, "O", self);
-    return pyRet;
-}
+    if (tcl_result == TCL_ERROR) {
+        // dig out tcl error information and create a tohil tcldict containing it
+        // (Tcl_GetReturnOptions returns a tcl dict object)
+        Tcl_Obj *returnOptionsObj = Tcl_GetReturnOptions(interp, tcl_result);
+        PyObject *pReturnOptionsObj = TohilTclDict_FromTclObj(returnOptionsObj);
 
-static PyObject *TohilTclObj_subscript(TohilTclObj *, PyObject *);
+        // construct a two-element tuple comprising the interpreter result
+        // and the tcldict containing the info grabbed from tcl
+        PyObject *pRetTuple = PyTuple_New(2);
+        int tclStringSize;
+        char *tclString;
+        tclString = Tcl_GetStringFromObj(resultObj, &tclStringSize);
+        PyTuple_SET_ITEM(pRetTuple, 0, Py_BuildValue("s#", tclString, tclStringSize));
+        PyTuple_SET_ITEM(pRetTuple, 1, pReturnOptionsObj);
 
-//
-// TohilTclObj_slice - return a python list containing a slice
-//   of the referenced tclobj as a list.
-//
-// significantly cribbed from cpython source for listobjects...
-//
-static PyObject *
-TohilTclObj_slice(TohilTclObj *self, Py_ssize_t ilow, Py_ssize_t ihigh)
-{
-    PyListObject *np;
-    int listObjc;
-    Tcl_Obj **listObjv;
-    Tcl_Obj **src;
-    Py_ssize_t i, len;
-    len = ihigh - ilow;
+        // ...and set the python error object to
+        // TclError(interp_result_string, tcldict_object)
+        PyErr_SetObject(pTohilTclErrorClass, pRetTuple);
+        return NULL;
+    }
 
-    int size = 0;
+    if (toType == NULL) {
+        if (resultObj->typePtr == &pyObjectObjType) {
+            return tohil_PyObjectObjGet(resultObj);
+        }
+        if (resultObj->typePtr == &pyBufferObjType) {
+            return tohil_PyBufferObjGet(resultObj);
+        }
+        return tohil_to_str(interp, resultObj);
+    }
+
+    // the built-in conversions are a handful of pointer compares
+    for (int i = 0; i < TOHIL_N_BUILTIN_CONVERTERS; i++) {
+        if (tohil_builtin_converters[i].type == toType) {
+            if (churnEnabled) {
+                TohilChurnCall churnCall;
+                tohil_ChurnBegin(&churnCall, &tohil_builtin_converters[i].churnSite, resultObj);
+                PyObject *pRet = tohil_builtin_converters[i].func(interp, resultObj);
+                tohil_ChurnEnd(&churnCall, resultObj);
+                return pRet;
+            }
+            return tohil_builtin_converters[i].func(interp, resultObj);
+        }
+    }
 
-    // get the list size and crack the list into a list objc and objv.
-    // any failure here probably means the object can't be represented as a list.
-    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    if (!PyType_Check(toType)) {
+        PyErr_SetString(PyExc_RuntimeError, "to type is not a valid python data type");
         return NULL;
     }
 
-    if (Tcl_ListObjGetElements(self->interp, self->tclobj, &listObjc, &listObjv) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    // anything else has to have been registered
+    PyObject *converter = PyDict_GetItemWithError(tohil_converters, (PyObject *)toType);
+    if (converter == NULL) {
+        if (!PyErr_Occurred()) {
+            PyErr_Format(PyExc_RuntimeError,
+                         "'to' conversion type must be str, int, bool, float, list, set, dict, tuple, tohil.tclobj, tohil.tcldict, tohil.auto "
+                         "or a type registered with tohil.register_converter, not %.200s",
+                         toType->tp_name);
+        }
         return NULL;
     }
 
-    np = (PyListObject *)PyList_New(len);
-    if (np == NULL) {
-        return NULL;
+    if (PyCapsule_IsValid(converter, "tohil.converter")) {
+        tohil_converter_func func = (tohil_converter_func)PyCapsule_GetPointer(converter, "tohil.converter");
+        return func(interp, resultObj);
     }
 
-    // src is a pointer to an array of pointers of obj,
-    // adjust it to the starting object and we'll walk it forward
-    src = &listObjv[ilow];
-    for (i = 0; i < len; i++) {
-        // create a new tclobj object and store
-        // it into the python list we are making
-        PyObject *v = tohil_python_return(self->interp, TCL_OK, self->to, src[i]);
-        PyList_SET_ITEM(np, i, v);
+    // python converters are handed the result as a tclobj, so
+    // nothing is shimmered or copied unless the converter asks
+    PyObject *pResult = TohilTclObj_FromTclObj(resultObj);
+    if (pResult == NULL) {
+        return NULL;
     }
-    return (PyObject *)np;
+    Py_INCREF(converter);
+    PyObject *pRet = PyObject_CallFunctionObjArgs(converter, pResult, NULL);
+    Py_DECREF(converter);
+    Py_DECREF(pResult);
+    return pRet;
 }
 
 //
-// TohilTclObj_item - return the i'th element of a tclobj containing
-//   a list, or set an error and return NULL if something's wrong
+// tohil.cache_info - return a dict of hit, miss and size statistics
+//   for the eval, expr and subst caches, plus the maximum cache size
 //
 static PyObject *
-TohilTclObj_item(TohilTclObj *self, Py_ssize_t i)
+tohil_cache_info(PyObject *self, PyObject *dummy)
 {
-    int size = 0;
-
-    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    PyObject *pInfo = PyDict_New();
+    if (pInfo == NULL) {
         return NULL;
     }
 
-    if (i < 0 || i >= size) {
-        PyErr_SetString(PyExc_IndexError, "list index out of range");
-        return NULL;
+    for (int i = 0; tohilCaches[i] != NULL; i++) {
+        TohilObjCache *cache = tohilCaches[i];
+        PyObject *pCacheInfo = Py_BuildValue("{s:l,s:l,s:i}", "hits", cache->hits, "misses", cache->misses, "size", cache->size);
+        if (pCacheInfo == NULL || PyDict_SetItemString(pInfo, cache->name, pCacheInfo) < 0) {
+            Py_XDECREF(pCacheInfo);
+            Py_DECREF(pInfo);
+            return NULL;
+        }
+        Py_DECREF(pCacheInfo);
     }
 
-    int listObjc;
-    Tcl_Obj **listObjv;
-
-    if (Tcl_ListObjGetElements(self->interp, self->tclobj, &listObjc, &listObjv) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    PyObject *pMaxSize = PyLong_FromLong(tohilCacheMaxSize);
+    if (pMaxSize == NULL || PyDict_SetItemString(pInfo, "maxsize", pMaxSize) < 0) {
+        Py_XDECREF(pMaxSize);
+        Py_DECREF(pInfo);
         return NULL;
     }
-
-    PyObject *ret = tohil_python_return(self->interp, TCL_OK, self->to, listObjv[i]);
-    Py_INCREF(ret);
-    return ret;
+    Py_DECREF(pMaxSize);
+    return pInfo;
 }
 
 //
-// TohilTclObj_ass_item - assign an item into a tclobj containing a list
+// tohil.cache_clear - empty the eval, expr and subst caches and zero their statistics
 //
-static int
-TohilTclObj_ass_item(TohilTclObj *self, Py_ssize_t i, PyObject *v)
+static PyObject *
+tohil_cache_clear(PyObject *self, PyObject *dummy)
 {
-    int size = 0;
-
-    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-        return -1;
-    }
-
-    if (i < 0 || i >= size) {
-        PyErr_SetString(PyExc_IndexError, "list assignment index out of range");
-        return -1;
+    for (int i = 0; tohilCaches[i] != NULL; i++) {
+        TohilObjCache *cache = tohilCaches[i];
+        TohilCache_Trim(cache, 0);
+        cache->hits = 0;
+        cache->misses = 0;
     }
+    Py_RETURN_NONE;
+}
 
-    if (v == NULL) {
-        PyErr_SetString(PyExc_RuntimeError, "slice assignment not implemented");
-        return -1;
-        // return list_ass_slice(self, i, i+1, v);
-    }
+//
+// tohil.cache_size - set the maximum number of entries in each of
+//   the eval, expr and subst caches.  0 disables caching.
+//
+static PyObject *
+tohil_cache_size(PyObject *self, PyObject *pMaxSize)
+{
+    long maxSize = 0;
 
-    Tcl_Obj *obj = pyObjToTcl(self->interp, v);
-    if (obj == NULL) {
-        return -1;
-    }
+    if (tohil_parse_long(pMaxSize, &maxSize) < 0)
+        return NULL;
 
-    // we are about to modify the object so if it's shared we need to copy
-    if (Tcl_IsShared(self->tclobj)) {
-        Tcl_DecrRefCount(self->tclobj);
-        self->tclobj = Tcl_DuplicateObj(self->tclobj);
+    if (maxSize < 0 || maxSize > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "cache size must not be negative or huge");
+        return NULL;
     }
 
-    if (Tcl_ListObjReplace(self->interp, self->tclobj, i, 1, 1, &obj) == TCL_ERROR) {
-        PyErr_SetString(PyExc_IndexError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-        return -1;
+    tohilCacheMaxSize = (int)maxSize;
+    for (int i = 0; tohilCaches[i] != NULL; i++) {
+        TohilCache_Trim(tohilCaches[i], tohilCacheMaxSize);
     }
-    return 0;
+    Py_RETURN_NONE;
 }
 
 //
-// TohilTclObj_length - return the length of the tclobj, looking at it
-//   as a tcl list.  returns -1 if string cannot be represented as
-//   a list, or 0 or larger, representing the number of elements
-//   in the list.
-//
+// tohil.churn_enable(on) - turn representation churn diagnostics on or off
 //
-static Py_ssize_t
-TohilTclObj_length(TohilTclObj *self, Py_ssize_t i)
+static PyObject *
+tohil_churn_enable(PyObject *self, PyObject *pOn)
 {
-    int size = 0;
-
-    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-        return -1;
+    int on = PyObject_IsTrue(pOn);
+    if (on < 0) {
+        return NULL;
     }
-
-    return size;
+    churnEnabled = on;
+    Py_RETURN_NONE;
 }
 
 //
-// TohilTclObj_subscript - subscript a tclobj.  we treat the tclobj
-//   as a list, so item can be an integer (to obtain a single element),
-//   or a slice (to obtain zero or more elements.)
-//
+// tohil.churn_stats() - return a dict of the churn counted for each
+//   operation since diagnostics were turned on or last cleared
+//
 static PyObject *
-TohilTclObj_subscript(TohilTclObj *self, PyObject *item)
+tohil_churn_stats(PyObject *self, PyObject *dummy)
 {
-    int size = 0;
-
-    if (Tcl_ListObjLength(self->interp, self->tclobj, &size) == TCL_ERROR) {
-        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+    PyObject *pStats = PyDict_New();
+    if (pStats == NULL) {
         return NULL;
     }
 
-    if (PyIndex_Check(item)) {
-        Py_ssize_t i;
-        i = PyNumber_AsSsize_t(item, PyExc_IndexError);
-        if (i == -1 && PyErr_Occurred())
-            return NULL;
-        if (i < 0)
-            i += size;
-
-        if (i < 0 || i >= size) {
-            PyErr_SetString(PyExc_IndexError, "list index out of range");
+    for (TohilChurnSite *site = churnSites; site != NULL; site = site->next) {
+        PyObject *pTransitions = (site->transitions != NULL) ? PyDict_Copy(site->transitions) : PyDict_New();
+        if (pTransitions == NULL) {
+            Py_DECREF(pStats);
             return NULL;
         }
-
-        Tcl_Obj *resultObj = NULL;
-        if (Tcl_ListObjIndex(self->interp, self->tclobj, i, &resultObj) == TCL_ERROR) {
-            PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        PyObject *pCallers = PyDict_New();
+        PyObject *pCaller, *pCounts;
+        Py_ssize_t pos = 0;
+        while (pCallers != NULL && site->callers != NULL && PyDict_Next(site->callers, &pos, &pCaller, &pCounts)) {
+            PyObject *pCopy = PyDict_Copy(pCounts);
+            if (pCopy == NULL || PyDict_SetItem(pCallers, pCaller, pCopy) < 0) {
+                Py_CLEAR(pCallers);
+            }
+            Py_XDECREF(pCopy);
+        }
+        if (pCallers == NULL) {
+            Py_DECREF(pTransitions);
+            Py_DECREF(pStats);
             return NULL;
         }
-        return tohil_python_return(self->interp, TCL_OK, self->to, resultObj);
-    } else if (PySlice_Check(item)) {
-        Py_ssize_t start, stop, step, slicelength, i;
-        size_t cur;
-        PyObject *result;
-        PyObject *it;
-
-        if (PySlice_Unpack(item, &start, &stop, &step) < 0) {
+        PyObject *pSite = Py_BuildValue("{s:l,s:l,s:N,s:l,s:l,s:l,s:l,s:l,s:N}", "calls", site->calls, "shimmers", site->shimmers, "transitions", pTransitions,
+                                        "string_reps", site->stringReps, "string_rep_bytes", site->stringRepBytes, "dups", site->dups, "dup_elements",
+                                        site->dupElements, "dup_bytes", site->dupBytes, "callers", pCallers);
+        if (pSite == NULL) {
+            Py_DECREF(pStats);
             return NULL;
         }
 
-        slicelength = PySlice_AdjustIndices(size, &start, &stop, step);
-
-        if (slicelength <= 0) {
-            return tohil_python_return(self->interp, TCL_OK, self->to, Tcl_NewObj());
-        } else if (step == 1) {
-            return TohilTclObj_slice(self, start, stop);
-        } else {
-            result = PyList_New(slicelength);
-            if (!result)
-                return NULL;
-
-            int listObjc;
-            Tcl_Obj **listObjv;
-
-            if (Tcl_ListObjGetElements(self->interp, self->tclobj, &listObjc, &listObjv) == TCL_ERROR) {
-                PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        // sites sharing a name, like tclobj[] through the mapping and the
+        // sequence slots, are added up
+        PyObject *pPrev = PyDict_GetItemString(pStats, site->name);
+        if (pPrev != NULL) {
+            if (tohil_ChurnAddCounts(pSite, pPrev) < 0) {
+                Py_DECREF(pSite);
+                Py_DECREF(pStats);
                 return NULL;
             }
-
-            for (cur = start, i = 0; i < slicelength; cur += (size_t)step, i++) {
-                it = tohil_python_return(self->interp, TCL_OK, self->to, listObjv[cur]);
-                PyList_SET_ITEM(result, i, it);
+            pos = 0;
+            while (PyDict_Next(PyDict_GetItemString(pPrev, "callers"), &pos, &pCaller, &pCounts)) {
+                PyObject *pMine = PyDict_GetItem(pCallers, pCaller);
+                if ((pMine == NULL) ? PyDict_SetItem(pCallers, pCaller, pCounts) < 0 : tohil_ChurnAddCounts(pMine, pCounts) < 0) {
+                    Py_DECREF(pSite);
+                    Py_DECREF(pStats);
+                    return NULL;
+                }
+            }
+            PyObject *pKey, *pCount;
+            pos = 0;
+            while (PyDict_Next(PyDict_GetItemString(pPrev, "transitions"), &pos, &pKey, &pCount)) {
+                PyObject *pMine = PyDict_GetItem(pTransitions, pKey);
+                PyObject *pSum = (pMine == NULL) ? (Py_INCREF(pCount), pCount) : PyNumber_Add(pMine, pCount);
+                if (pSum == NULL || PyDict_SetItem(pTransitions, pKey, pSum) < 0) {
+                    Py_XDECREF(pSum);
+                    Py_DECREF(pSite);
+                    Py_DECREF(pStats);
+                    return NULL;
+                }
+                Py_DECREF(pSum);
             }
-            return result;
         }
-    } else {
-        PyErr_Format(PyExc_TypeError, "list indices must be integers or slices, not %.200s", Py_TYPE(item)->tp_name);
-        return NULL;
+
+        if (PyDict_SetItemString(pStats, site->name, pSite) < 0) {
+            Py_DECREF(pSite);
+            Py_DECREF(pStats);
+            return NULL;
+        }
+        Py_DECREF(pSite);
     }
+    return pStats;
 }
 
 //
+// tohil.churn_clear() - forget the churn counted so far
 //
-// end of python tcl object "tclobj"
+static PyObject *
+tohil_churn_clear(PyObject *self, PyObject *dummy)
+{
+    TohilChurnSite *next;
+    for (TohilChurnSite *site = churnSites; site != NULL; site = next) {
+        next = site->next;
+        site->linked = 0;
+        site->next = NULL;
+        site->calls = site->shimmers = site->stringReps = site->stringRepBytes = 0;
+        site->dups = site->dupElements = site->dupBytes = 0;
+        Py_CLEAR(site->transitions);
+        Py_CLEAR(site->callers);
+    }
+    churnSites = NULL;
+    Py_RETURN_NONE;
+}
+
 //
+// tohil.pystr_cache(on) - turn on or off keeping the python strs made
+//   from pure string tcl objects in the objects, for the next time
 //
+static PyObject *
+tohil_pystr_cache(PyObject *self, PyObject *pOn)
+{
+    int on = PyObject_IsTrue(pOn);
+    if (on < 0) {
+        return NULL;
+    }
+    pyStrCacheEnabled = on;
+    Py_RETURN_NONE;
+}
 
 //
+// tohil.intern_cache_info - return a dict of hit, miss and size
+//   statistics and the settings of the string intern cache
 //
-// start of tclobj td_iterator python datatype
+static PyObject *
+tohil_intern_cache_info(PyObject *self, PyObject *dummy)
+{
+    return Py_BuildValue("{s:l,s:l,s:i,s:i,s:i}", "hits", internCache.hits, "misses", internCache.misses, "size", internCache.used, "maxsize",
+                         internCache.nSlots, "max_length", internCache.maxLength);
+}
+
 //
+// tohil.intern_cache_clear - empty the string intern cache and zero
+//   its statistics
 //
-
-typedef struct {
-    PyObject_HEAD;
-    int started;
-    int done;
-    PyTypeObject *to;
-    Tcl_Interp *interp;
-    Tcl_Obj *dictObj;
-    Tcl_DictSearch search;
-} PyTohil_TD_IterObj;
-
 static PyObject *
-PyTohil_TD_iter(PyTohil_TD_IterObj *self)
+tohil_intern_cache_clear(PyObject *self, PyObject *dummy)
 {
-    // printf("PyTohil_TD_iter\n");
-    Py_INCREF(self);
-
-    self->started = 0;
-    self->done = 0;
-
-    return (PyObject *)self;
+    tohil_InternCacheEmpty();
+    internCache.hits = 0;
+    internCache.misses = 0;
+    Py_RETURN_NONE;
 }
 
 //
-// td's iternext - we have to do the DictObjFirst here since
-//   tcl's version, first gives you also the first result.
+// tohil.intern_cache_config(size=None, max_length=None) - turn the string
+//   intern cache on with room for size strings, rounded up to a power of
+//   two, of up to max_length bytes.  a size of 0 turns it off.  changing
+//   either setting empties the cache.  if the table can't be allocated,
+//   MemoryError is raised and the settings stay as they were.
 //
-PyObject *
-PyTohil_TD_iternext(PyTohil_TD_IterObj *self)
+static PyObject *
+tohil_intern_cache_config(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    // printf("PyTohil_TD_iternext\n");
-    Tcl_Obj *keyObj = NULL;
-    Tcl_Obj *valueObj = NULL;
-    int done = 0;
+    static const char *const kwlist[] = {"size", "max_length", NULL};
+    PyObject *values[2];
+    long size = internCache.nSlots;
+    long maxLength = internCache.maxLength;
 
-    int utf8len;
-    char *utf8string;
-
-    if (self->done) {
-    done:
-        PyErr_SetNone(PyExc_StopIteration);
+    if (tohil_parse_args("intern_cache_config", args, nargs, kwnames, kwlist, 0, 2, values) < 0) {
+        return NULL;
+    }
+    if (values[0] != NULL && values[0] != Py_None && tohil_parse_long(values[0], &size) < 0) {
+        return NULL;
+    }
+    if (values[1] != NULL && values[1] != Py_None && tohil_parse_long(values[1], &maxLength) < 0) {
         return NULL;
     }
 
-    if (self->started == 0) {
-        self->started = 1;
-        // substitute &valueObj for NULL below if you also want the value
-        if (Tcl_DictObjFirst(tcl_interp, self->dictObj, &self->search, &keyObj, &valueObj, &done) == TCL_ERROR) {
-            PyErr_Format(PyExc_TypeError, "tclobj contents cannot be converted into a td");
-            return NULL;
-        }
-    } else {
-        // not the first time though, get the next entry
-        Tcl_DictObjNext(&self->search, &keyObj, &valueObj, &done);
+    if (size < 0 || size > (1 << 24)) {
+        PyErr_SetString(PyExc_ValueError, "intern cache size must be between 0 and 16777216");
+        return NULL;
+    }
+    if (maxLength < 1 || maxLength > TOHIL_INTERN_MAX_LENGTH_LIMIT) {
+        PyErr_Format(PyExc_ValueError, "intern cache max_length must be between 1 and %d", TOHIL_INTERN_MAX_LENGTH_LIMIT);
+        return NULL;
     }
 
-    if (done) {
-        Tcl_DictObjDone(&self->search);
-        self->done = 1;
-        Tcl_DecrRefCount(self->dictObj);
-        self->dictObj = NULL;
-        Py_XDECREF(self->to);
-        self->to = NULL;
-        goto done;
+    int nSlots = 0;
+    if (size > 0) {
+        for (nSlots = 1; nSlots < size; nSlots <<= 1)
+            ;
     }
 
-    if (self->to == NULL) {
-        int tclStringSize;
-        char *tclString = Tcl_GetStringFromObj(keyObj, &tclStringSize);
+    tohil_InternCacheEmpty();
+    if (nSlots != internCache.nSlots || maxLength != internCache.maxLength) {
+        TohilInternEntry *slots = NULL;
+        char *bytes = NULL;
 
-        if (tohil_TclToUTF8(tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(tcl_interp)));
-            return NULL;
+        // the table can be gigabytes, so running out is a python error
+        // rather than a tcl panic
+        if (nSlots > 0) {
+            slots = (TohilInternEntry *)PyMem_Calloc(nSlots, sizeof(TohilInternEntry));
+            bytes = (char *)PyMem_Malloc((size_t)nSlots * maxLength);
+            if (slots == NULL || bytes == NULL) {
+                PyMem_Free(slots);
+                PyMem_Free(bytes);
+                return PyErr_NoMemory();
+            }
         }
-        PyObject *pObj = Py_BuildValue("s#", utf8string, utf8len);
-        ckfree(utf8string);
-        return pObj;
+        PyMem_Free(internCache.slots);
+        PyMem_Free(internCache.bytes);
+        internCache.slots = slots;
+        internCache.bytes = bytes;
+        internCache.nSlots = nSlots;
     }
+    internCache.maxLength = (int)maxLength;
+    Py_RETURN_NONE;
+}
 
-    // they specified a to, return a tuple
-    PyObject *pRetTuple = PyTuple_New(2);
+//
+// tohil.eval command for python to eval code in the tcl interpreter
+//
+static PyObject *
+tohil_eval(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"tcl_code", "to", NULL};
+    PyObject *values[2];
 
-    int tclStringSize;
-    char *tclString = Tcl_GetStringFromObj(keyObj, &tclStringSize);
+    if (tohil_parse_args("eval", args, nargs, kwnames, kwlist, 1, 1, values) < 0)
+        return NULL;
 
-    if (tohil_TclToUTF8(tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(tcl_interp)));
+    PyTypeObject *to = (PyTypeObject *)values[1];
+    const char *utf8Code = tohil_parse_utf8("eval", "tcl_code", values[0]);
+    if (utf8Code == NULL)
         return NULL;
-    }
-    PyTuple_SET_ITEM(pRetTuple, 0, Py_BuildValue("s#", utf8string, utf8len));
-    ckfree(utf8string);
 
-    PyTuple_SET_ITEM(pRetTuple, 1, tohil_python_return(tcl_interp, TCL_OK, self->to, valueObj));
+    Tcl_Obj *codeObj = TohilCache_GetTextObj(&evalCache, utf8Code);
+    Tcl_IncrRefCount(codeObj);
+    int result = Tcl_EvalObjEx(tcl_interp, codeObj, 0);
+    Tcl_DecrRefCount(codeObj);
+    Tcl_Obj *resultObj = Tcl_GetObjResult(tcl_interp);
 
-    return pRetTuple;
+    return tohil_python_return(tcl_interp, result, to, resultObj);
 }
 
-static PyTypeObject PyTohil_TD_IterType = {
-    .tp_name = "tohil._td_iter",
-    .tp_basicsize = sizeof(PyTohil_TD_IterObj),
-    .tp_flags = Py_TPFLAGS_DEFAULT,
-    .tp_doc = "tohil TD iterator object",
-    .tp_iter = (getiterfunc)PyTohil_TD_iter,
-    .tp_iternext = (iternextfunc)PyTohil_TD_iternext,
-};
-
-//
-//
-// end of tclobj td_iterator python datatype
-//
-//
-
 //
-// TohilTclObj_getto - get "to" value, settable attribute for what
-//   type to convert tclobjs and tcldicts to
+// tohil.expr command for python to evaluate expressions using the tcl interpreter
 //
 static PyObject *
-TohilTclObj_getto(TohilTclObj *self, void *closure)
-{
-    if (self->to == NULL) {
-        Py_RETURN_NONE;
-    }
-    Py_INCREF(self->to);
-    return (PyObject *)self->to;
-}
-
-//
-// TohilTclObj_getto - get "to" value, attribute for what
-//   type to convert tclobjs and tcldicts to
-//
-static int
-TohilTclObj_setto(TohilTclObj *self, PyTypeObject *toType, void *closure)
+tohil_expr(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    if (!PyType_Check(toType)) {
-        return -1;
-    }
-    PyTypeObject *tmp = self->to;
-    self->to = toType;
-    Py_INCREF(toType);
-    Py_XDECREF(tmp);
-    return 0;
-}
+    static const char *const kwlist[] = {"expression", "to", NULL};
+    PyObject *values[2];
 
-static PyGetSetDef TohilTclObj_getsetters[] = {
-    {"to", (getter)TohilTclObj_getto, (setter)TohilTclObj_setto, "python type to default returns to", NULL},
-    {"_refcount", (getter)TohilTclObj_refcount, NULL, "reference count of the embedded tcl object", NULL},
-    {"_tcltype", (getter)TohilTclObj_type, NULL, "internal tcl data type of the tcl object", NULL},
-    {NULL}};
+    if (tohil_parse_args("expr", args, nargs, kwnames, kwlist, 1, 1, values) < 0)
+        return NULL;
 
-static PyMappingMethods TohilTclObj_as_mapping = {(lenfunc)TohilTclObj_length, (binaryfunc)TohilTclObj_subscript, NULL};
+    PyTypeObject *to = (PyTypeObject *)values[1];
+    const char *utf8expression = tohil_parse_utf8("expr", "expression", values[0]);
+    if (utf8expression == NULL)
+        return NULL;
 
-static PySequenceMethods TohilTclObj_as_sequence = {
-    .sq_length = (lenfunc)TohilTclObj_length,
-    // .sq_concat = (binaryfunc)tclobj_concat,
-    // .sq_repeat = (ssizeargfunc)tclobj_repeat,
-    .sq_item = (ssizeargfunc)TohilTclObj_item,
-    .sq_ass_item = (ssizeobjargproc)TohilTclObj_ass_item,
-    // .sq_contains = (objobjproc)list_contains,
-    //.sq_inplace_concat = (binaryfunc)list_inplace_concat,
-    //.sq_inplace_repeat = (ssizeargfunc)list_inplace_repeat,
-};
+    Tcl_Obj *expressionObj = TohilCache_GetTextObj(&exprCache, utf8expression);
+    Tcl_IncrRefCount(expressionObj);
 
-static PyMethodDef TohilTclObj_methods[] = {
-    {"__getitem__", (PyCFunction)TohilTclObj_subscript, METH_O | METH_COEXIST, "x.__getitem__(y) <==> x[y]"},
-    {"reset", (PyCFunction)TohilTclObj_reset, METH_NOARGS, "reset the tclobj"},
-    {"as_str", (PyCFunction)TohilTclObj_as_string, METH_NOARGS, "return tclobj as str"},
-    {"as_int", (PyCFunction)TohilTclObj_as_int, METH_NOARGS, "return tclobj as int"},
-    {"as_float", (PyCFunction)TohilTclObj_as_float, METH_NOARGS, "return tclobj as float"},
-    {"as_bool", (PyCFunction)TohilTclObj_as_bool, METH_NOARGS, "return tclobj as bool"},
-    {"as_list", (PyCFunction)TohilTclObj_as_list, METH_NOARGS, "return tclobj as list"},
-    {"as_set", (PyCFunction)TohilTclObj_as_set, METH_NOARGS, "return tclobj as set"},
-    {"as_tuple", (PyCFunction)TohilTclObj_as_tuple, METH_NOARGS, "return tclobj as tuple"},
-    {"as_dict", (PyCFunction)TohilTclObj_as_dict, METH_NOARGS, "return tclobj as dict"},
-    {"as_tclobj", (PyCFunction)TohilTclObj_as_tclobj, METH_NOARGS, "return tclobj as tclobj"},
-    {"as_tcldict", (PyCFunction)TohilTclObj_as_tcldict, METH_NOARGS, "return tclobj as tcldict"},
-    {"as_byte_array", (PyCFunction)TohilTclObj_as_byte_array, METH_NOARGS, "return tclobj as a byte array"},
-    {"incr", (PyCFunction)TohilTclObj_incr, METH_VARARGS | METH_KEYWORDS, "increment tclobj as int"},
-    {"llength", (PyCFunction)TohilTclObj_llength, METH_NOARGS, "length of tclobj tcl list"},
-    {"getvar", (PyCFunction)TohilTclObj_getvar, METH_O, "set tclobj to tcl var or array element"},
-    {"setvar", (PyCFunction)TohilTclObj_setvar, METH_O, "set tcl var or array element to tclobj's tcl object"},
-    {"set", (PyCFunction)TohilTclObj_set, METH_O, "set tclobj from some python object"},
-    {"lindex", (PyCFunction)TohilTclObj_lindex, METH_VARARGS | METH_KEYWORDS, "get value from tclobj as tcl list"},
-    {"lappend", (PyCFunction)TohilTclObj_lappend, METH_O, "lappend (list-append) something to tclobj"},
-    {"lappend_list", (PyCFunction)TohilTclObj_lappend_list, METH_O, "lappend another tclobj or a python list of stuff to tclobj"},
-    {NULL} // sentinel
-};
+    Tcl_Obj *resultObj = NULL;
+    int result = Tcl_ExprObj(tcl_interp, expressionObj, &resultObj);
+    Tcl_DecrRefCount(expressionObj);
+    if (result == TCL_ERROR) {
+        char *errMsg = Tcl_GetString(Tcl_GetObjResult(tcl_interp));
+        PyErr_SetString(PyExc_RuntimeError, errMsg);
+        return NULL;
+    }
 
-static PyTypeObject TohilTclObjType = {
-    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "tohil.tclobj",
-    .tp_doc = "Tcl Object",
-    .tp_basicsize = sizeof(TohilTclObj),
-    .tp_itemsize = 0,
-    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
-    .tp_new = TohilTclObj_new,
-    .tp_init = (initproc)TohilTclObj_init,
-    .tp_dealloc = (destructor)TohilTclObj_dealloc,
-    .tp_methods = TohilTclObj_methods,
-    .tp_str = (reprfunc)TohilTclObj_str,
-    .tp_iter = (getiterfunc)TohilTclObjIter,
-    .tp_as_sequence = &TohilTclObj_as_sequence,
-    .tp_as_mapping = &TohilTclObj_as_mapping,
-    .tp_repr = (reprfunc)TohilTclObj_repr,
-    .tp_richcompare = (richcmpfunc)TohilTclObj_richcompare,
-    .tp_getset = TohilTclObj_getsetters,
-};
+    // Tcl_ExprObj hands us a result with its reference count incremented
+    PyObject *pRet = tohil_python_return(tcl_interp, TCL_OK, to, resultObj);
+    Tcl_DecrRefCount(resultObj);
+    return pRet;
+}
 
 //
-// end of tclobj python datatype
+// tohil.convert command for python to pass a python object through
+// to a tcl object and then convert it to a to= destination type
 //
+static PyObject *
+tohil_convert(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"pyobject", "to", NULL};
+    PyObject *values[2];
 
-//
-// start of tcldict python datatype
-//
+    if (tohil_parse_args("convert", args, nargs, kwnames, kwlist, 1, 1, values) < 0)
+        return NULL;
+
+    PyObject *pyInputObject = values[0];
+    PyTypeObject *to = (PyTypeObject *)values[1];
+
+    Tcl_Obj *interimObj = pyObjToTcl(tcl_interp, pyInputObject);
+    if (interimObj == NULL) {
+        return NULL;
+    }
 
-// the object's python data structure is the same as tclobj
-// so we can reuse that to the max.  we're going to have different
-// iterators and stuff for dicts
+    return tohil_python_return(tcl_interp, TCL_OK, to, interimObj);
+}
 
 //
-// return true if python object is a tclobj type
+// tohil.pyref(obj) - return a tclobj holding a reference to obj, which
+//   tcl can store and pass around and hand back to python as obj
+//   itself, converting it only if tcl looks at it as a string
 //
-int
-TohilTclDict_Check(PyObject *pyObj)
+static PyObject *
+tohil_pyref(PyObject *self, PyObject *pObj)
 {
-    return PyObject_TypeCheck(pyObj, &TohilTclDictType);
+    Tcl_Obj *obj = Tcl_NewObj();
+    Tcl_InvalidateStringRep(obj);
+    Py_INCREF(pObj);
+    obj->internalRep.twoPtrValue.ptr1 = pObj;
+    obj->typePtr = &pyObjectObjType;
+
+    PyObject *pRef = TohilTclObj_FromTclObj(obj);
+    if (pRef == NULL) {
+        Tcl_IncrRefCount(obj);
+        Tcl_DecrRefCount(obj);
+    }
+    return pRef;
 }
 
 //
-// create a new python tcldict object from any Tcl_Obj
+// tohil.pybuffer(obj) - return a tclobj holding the bytes of obj, which
+//   has to export a buffer, without copying them
 //
 static PyObject *
-TohilTclDict_FromTclObj(Tcl_Obj *obj)
+tohil_pybuffer(PyObject *self, PyObject *pObj)
 {
-    TohilTclObj *self = (TohilTclObj *)TohilTclDictType.tp_alloc(&TohilTclDictType, 0);
-    if (self != NULL) {
-        self->interp = tcl_interp;
-        self->tclobj = obj;
+    TohilPyBuffer *buffer = (TohilPyBuffer *)ckalloc(sizeof(TohilPyBuffer));
+    if (PyObject_GetBuffer(pObj, &buffer->view, PyBUF_SIMPLE) < 0) {
+        ckfree(buffer);
+        return NULL;
+    }
+    if (buffer->view.len > INT_MAX) {
+        PyBuffer_Release(&buffer->view);
+        ckfree(buffer);
+        PyErr_SetString(PyExc_OverflowError, "buffer is too big for tcl");
+        return NULL;
+    }
+    buffer->refCount = 1;
+
+    Tcl_Obj *obj = Tcl_NewObj();
+    Tcl_InvalidateStringRep(obj);
+    obj->internalRep.twoPtrValue.ptr1 = buffer;
+    obj->typePtr = &pyBufferObjType;
+
+    PyObject *pRef = TohilTclObj_FromTclObj(obj);
+    if (pRef == NULL) {
         Tcl_IncrRefCount(obj);
+        Tcl_DecrRefCount(obj);
     }
-    return (PyObject *)self;
+    return pRef;
 }
 
 //
-// td - tcl dict stuff
+//
+// columns
+//
+// tcl procs commonly return a list of rows, each a dict, or a list, of
+// the same fields.  tohil.columns walks such a list once, in C, and
+// hands back one python list or array.array per field, and
+// tohil.from_columns builds the list of rows from python columns.
+//
 //
 
 //
-// td_locate(key) - do a dict get on the tclobj object using
-//   either a list of keys or a singleton key, and return
-//   the target value object.
+// tohil.columns(obj, fields=None, types=None) - return a dict of the
+//   fields of obj, a tcl list of rows, as columns.
 //
-//   internal routine used by td_get and td_exists
+// fields are dict keys, for rows that are dicts, or int positions, for
+// rows that are lists.  with no fields, the keys of the first row are
+// used.  types gives the python type of each column, as a to= type, a
+// column is a list of values converted that way, or as an array
+// typecode string, a column is an array.array of those numbers.  None
+// or no types is str.
 //
-static Tcl_Obj *
-TohilTclDict_td_locate(TohilTclObj *self, PyObject *keys)
+static PyObject *
+tohil_columns(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    // printf("TohilTclDict_td_locate\n");
-    Tcl_Obj *keyObj = NULL;
-    Tcl_Obj *valueObj = NULL;
+    static const char *const kwlist[] = {"obj", "fields", "types", NULL};
+    PyObject *values[3];
+    Tcl_Interp *interp = tcl_interp;
 
-    if (PyList_Check(keys)) {
-        int i;
-        Tcl_Obj *dictPtrObj = self->tclobj;
-        Py_ssize_t nKeys = PyList_GET_SIZE(keys);
+    if (tohil_parse_args("columns", args, nargs, kwnames, kwlist, 1, 3, values) < 0) {
+        return NULL;
+    }
 
-        for (i = 0; i < nKeys; i++) {
-            PyObject *keyPyObj = PyList_GET_ITEM(keys, i);
-            keyObj = pyObjToTcl(self->interp, keyPyObj);
+    Tcl_Obj *listObj;
+    if (TohilTclObj_Check(values[0]) || TohilTclDict_Check(values[0])) {
+        if (TohilTclObj_Exported((TohilTclObj *)values[0])) {
+            return NULL;
+        }
+        listObj = ((TohilTclObj *)values[0])->tclobj;
+    } else if ((listObj = _pyObjToTcl(interp, values[0])) == NULL) {
+        return NULL;
+    }
+    // held so the rows stay put even if a to= converter runs tcl code
+    Tcl_IncrRefCount(listObj);
+
+    PyObject *pResult = NULL;
+    PyObject *pFields = NULL;
+    PyObject *pTypes = NULL;
+    Py_ssize_t nFields = 0;
+    Tcl_Obj **keyObjs = NULL;
+    long *positions = NULL;
+    char *typecodes = NULL;
+    Py_ssize_t *itemsizes = NULL;
+    PyObject **pColumns = NULL;
+    Py_buffer *views = NULL;
+
+    int nRows;
+    if (Tcl_ListObjLength(interp, listObj, &nRows) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        goto done;
+    }
 
-            if (Tcl_DictObjGet(self->interp, dictPtrObj, keyObj, &valueObj) == TCL_ERROR) {
-                Tcl_DecrRefCount(keyObj);
-                PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
-                return NULL;
+    // no fields, take the keys of the first row
+    if (values[1] == NULL || values[1] == Py_None) {
+        pFields = PyList_New(0);
+        if (pFields == NULL) {
+            goto done;
+        }
+        if (nRows > 0) {
+            Tcl_Obj *rowObj;
+            Tcl_ListObjIndex(NULL, listObj, 0, &rowObj);
+            Tcl_DictSearch search;
+            Tcl_Obj *keyObj;
+            int searchDone;
+            if (Tcl_DictObjFirst(interp, rowObj, &search, &keyObj, NULL, &searchDone) == TCL_ERROR) {
+                PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+                goto done;
             }
-            if (valueObj == NULL) {
-                Tcl_DecrRefCount(keyObj);
-                return NULL;
+            for (; !searchDone; Tcl_DictObjNext(&search, &keyObj, NULL, &searchDone)) {
+                PyObject *pKey = tohil_TclObjToPyString(keyObj);
+                if (pKey == NULL || PyList_Append(pFields, pKey) < 0) {
+                    Py_XDECREF(pKey);
+                    Tcl_DictObjDone(&search);
+                    goto done;
+                }
+                Py_DECREF(pKey);
             }
-            dictPtrObj = valueObj;
-            Tcl_DecrRefCount(keyObj);
         }
+    } else if ((pFields = PySequence_Fast(values[1], "columns fields must be a sequence")) == NULL) {
+        goto done;
+    }
+    nFields = PySequence_Fast_GET_SIZE(pFields);
 
-        // at this point if there's been no error valueObj has our guy
-    } else {
-        // it's a singleton
-        Tcl_Obj *keyObj = pyObjToTcl(self->interp, keys);
-
-        if (Tcl_DictObjGet(NULL, self->tclobj, keyObj, &valueObj) == TCL_ERROR) {
-            Tcl_DecrRefCount(keyObj);
-            PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
-            return NULL;
+    if (values[2] != NULL && values[2] != Py_None) {
+        if ((pTypes = PySequence_Fast(values[2], "columns types must be a sequence")) == NULL) {
+            goto done;
+        }
+        if (PySequence_Fast_GET_SIZE(pTypes) != nFields) {
+            PyErr_Format(PyExc_ValueError, "columns got %zd types for %zd fields", PySequence_Fast_GET_SIZE(pTypes), nFields);
+            goto done;
         }
-        Tcl_DecrRefCount(keyObj);
     }
 
-    return valueObj;
-}
+    keyObjs = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * (nFields + 1));
+    positions = (long *)ckalloc(sizeof(long) * (nFields + 1));
+    typecodes = ckalloc(nFields + 1);
+    itemsizes = (Py_ssize_t *)ckalloc(sizeof(Py_ssize_t) * (nFields + 1));
+    pColumns = (PyObject **)ckalloc(sizeof(PyObject *) * (nFields + 1));
+    views = (Py_buffer *)ckalloc(sizeof(Py_buffer) * (nFields + 1));
+    for (Py_ssize_t f = 0; f < nFields; f++) {
+        keyObjs[f] = NULL;
+        pColumns[f] = NULL;
+        views[f].obj = NULL;
+    }
 
-//
-// td_get(key) - do a dict get on the tcl object
-//
-static PyObject *
-TohilTclDict_td_get(TohilTclObj *self, PyObject *args, PyObject *kwargs)
-{
-    static char *kwlist[] = {"key", "to", "default", NULL};
-    PyObject *keys = NULL;
-    PyTypeObject *to = NULL;
-    PyObject *pDefault = NULL;
+    for (Py_ssize_t f = 0; f < nFields; f++) {
+        PyObject *pField = PySequence_Fast_GET_ITEM(pFields, f);
+        PyObject *pType = (pTypes == NULL) ? Py_None : PySequence_Fast_GET_ITEM(pTypes, f);
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|$OO", kwlist, &keys, &to, &pDefault)) {
-        return NULL;
+        if (PyLong_Check(pField)) {
+            if (tohil_parse_long(pField, &positions[f]) < 0) {
+                goto done;
+            }
+        } else {
+            if ((keyObjs[f] = _pyObjToTcl(interp, pField)) == NULL) {
+                goto done;
+            }
+            Tcl_IncrRefCount(keyObjs[f]);
+        }
+
+        if (PyUnicode_Check(pType)) {
+            if ((itemsizes[f] = tohil_ArrayItemSize(pType, &typecodes[f])) < 0) {
+                goto done;
+            }
+            // filled in place through views[f]
+            pColumns[f] = tohil_NewFilledArray(typecodes[f], nRows, &views[f]);
+        } else if (pType == Py_None || PyType_Check(pType)) {
+            typecodes[f] = '\0';
+            pColumns[f] = PyList_New(nRows);
+        } else {
+            PyErr_Format(PyExc_TypeError, "columns types must be types, array typecodes or None, not %.200s", Py_TYPE(pType)->tp_name);
+            goto done;
+        }
+        if (pColumns[f] == NULL) {
+            goto done;
+        }
     }
 
-    Tcl_Obj *valueObj = TohilTclDict_td_locate(self, keys);
-    if (valueObj == NULL) {
-        if (pDefault != NULL) {
-            if (to == NULL) {
-                // not there but they provided a default,
-                // give them their default
-                Py_INCREF(pDefault);
-                return pDefault;
+    for (int i = 0; i < nRows; i++) {
+        // fetched a row at a time, and held while it's used, in case a
+        // to= converter runs tcl code that shimmers the list
+        Tcl_Obj *rowObj;
+        if (Tcl_ListObjIndex(interp, listObj, i, &rowObj) == TCL_ERROR) {
+            PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+            goto done;
+        }
+        Tcl_IncrRefCount(rowObj);
+
+        for (Py_ssize_t f = 0; f < nFields; f++) {
+            Tcl_Obj *valueObj = NULL;
+            int status;
+            if (keyObjs[f] != NULL) {
+                status = Tcl_DictObjGet(interp, rowObj, keyObjs[f], &valueObj);
             } else {
-                valueObj = pyObjToTcl(self->interp, pDefault);
+                status = (positions[f] < 0 || positions[f] > INT_MAX) ? TCL_OK : Tcl_ListObjIndex(interp, rowObj, (int)positions[f], &valueObj);
+            }
+            if (status == TCL_ERROR) {
+                PyErr_Format(PyExc_TypeError, "row %d: %s", i, Tcl_GetString(Tcl_GetObjResult(interp)));
+            } else if (valueObj == NULL) {
+                PyErr_Format(keyObjs[f] != NULL ? PyExc_KeyError : PyExc_IndexError, "row %d has no field %R", i,
+                             PySequence_Fast_GET_ITEM(pFields, f));
+            } else if (typecodes[f] != '\0') {
+                tohil_StoreArrayItem(interp, valueObj, typecodes[f], (char *)views[f].buf + itemsizes[f] * i);
+            } else {
+                PyObject *pType = (pTypes == NULL) ? Py_None : PySequence_Fast_GET_ITEM(pTypes, f);
+                PyObject *pValue = tohil_python_return(interp, TCL_OK, (pType == Py_None) ? NULL : (PyTypeObject *)pType, valueObj);
+                if (pValue != NULL) {
+                    PyList_SET_ITEM(pColumns[f], i, pValue);
+                }
+            }
+            if (PyErr_Occurred()) {
+                Tcl_DecrRefCount(rowObj);
+                goto done;
             }
-        } else {
-            // not there, no default.  it's an error.
-            // this is clean and the way python does it.
-            PyErr_SetObject(PyExc_KeyError, keys);
-            return NULL;
         }
+        Tcl_DecrRefCount(rowObj);
     }
 
-    if (to == NULL && self->to != NULL)
-        to = self->to;
+    pResult = PyDict_New();
+    for (Py_ssize_t f = 0; pResult != NULL && f < nFields; f++) {
+        if (PyDict_SetItem(pResult, PySequence_Fast_GET_ITEM(pFields, f), pColumns[f]) < 0) {
+            Py_CLEAR(pResult);
+        }
+    }
 
-    return tohil_python_return(self->interp, TCL_OK, to, valueObj);
+done:
+    for (Py_ssize_t f = 0; pColumns != NULL && f < nFields; f++) {
+        if (keyObjs[f] != NULL) {
+            Tcl_DecrRefCount(keyObjs[f]);
+        }
+        if (views[f].obj != NULL) {
+            PyBuffer_Release(&views[f]);
+        }
+        Py_XDECREF(pColumns[f]);
+    }
+    if (pColumns != NULL) {
+        ckfree((char *)keyObjs);
+        ckfree((char *)positions);
+        ckfree(typecodes);
+        ckfree((char *)itemsizes);
+        ckfree((char *)pColumns);
+        ckfree((char *)views);
+    }
+    Py_XDECREF(pFields);
+    Py_XDECREF(pTypes);
+    Tcl_DecrRefCount(listObj);
+    return pResult;
 }
 
 //
-// TohilTclDict_subscript - return the value of an element in
-//   the tcl dict.  value may itself be a sub-dictionary.
+// tohil_ColumnToTcl - convert the count values of a python column to tcl
+//   objects, stored in objv.  numbers in a one-dimensional buffer, like
+//   an array.array, are read straight out of it, and anything else is
+//   treated as a sequence.  return -1 with a python error if it fails,
+//   including if the column doesn't have count values.
 //
-//   key can be a list of keys in which case the tcl dict is
-//   treated as a hierarchy of dicts.
+static int
+tohil_ColumnToTcl(Tcl_Interp *interp, PyObject *pName, PyObject *pColumn, Py_ssize_t count, Tcl_Obj **objv)
+{
+    Py_buffer view;
+
+    if (PyObject_CheckBuffer(pColumn) && PyObject_GetBuffer(pColumn, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) == 0) {
+        char kind = tohil_BufferKind(&view);
+        if (kind != 0 && view.ndim == 1) {
+            if (view.shape[0] != count) {
+                PyErr_Format(PyExc_ValueError, "column %R has %zd values, not %zd", pName, view.shape[0], count);
+                PyBuffer_Release(&view);
+                return -1;
+            }
+            for (Py_ssize_t i = 0; i < count; i++) {
+                objv[i] = tohil_BufferItemToTcl((const char *)view.buf + i * view.itemsize, kind, view.itemsize);
+            }
+            PyBuffer_Release(&view);
+            return 0;
+        }
+        PyBuffer_Release(&view);
+    }
+    PyErr_Clear();
+
+    PyObject *pSeq = PySequence_Fast(pColumn, "from_columns columns must be sequences");
+    if (pSeq == NULL) {
+        return -1;
+    }
+    if (PySequence_Fast_GET_SIZE(pSeq) != count) {
+        PyErr_Format(PyExc_ValueError, "column %R has %zd values, not %zd", pName, PySequence_Fast_GET_SIZE(pSeq), count);
+        Py_DECREF(pSeq);
+        return -1;
+    }
+    for (Py_ssize_t i = 0; i < count; i++) {
+        objv[i] = _pyObjToTcl(interp, PySequence_Fast_GET_ITEM(pSeq, i));
+        if (objv[i] == NULL) {
+            for (Py_ssize_t j = 0; j < i; j++) {
+                Tcl_IncrRefCount(objv[j]);
+                Tcl_DecrRefCount(objv[j]);
+            }
+            Py_DECREF(pSeq);
+            return -1;
+        }
+    }
+    Py_DECREF(pSeq);
+    return 0;
+}
+
+//
+// tohil.from_columns(columns, to=dict) - return a tclobj holding a tcl
+//   list of rows made from columns, a dict of field names to sequences
+//   of values.  with to=dict each row is a dict of the fields, with
+//   to=list it's a list of the values in the order of the columns.
 //
 static PyObject *
-TohilTclDict_subscript(TohilTclObj *self, PyObject *keys)
+tohil_from_columns(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    // printf("TohilTclDict_subscript\n");
-    Tcl_Obj *valueObj = TohilTclDict_td_locate(self, keys);
-    if (valueObj == NULL) {
-        // not there, no default.  it's an error.
-        // this is clean and the way python does it.
-        PyErr_SetObject(PyExc_KeyError, keys);
+    static const char *const kwlist[] = {"columns", "to", NULL};
+    PyObject *values[2];
+    Tcl_Interp *interp = tcl_interp;
+
+    if (tohil_parse_args("from_columns", args, nargs, kwnames, kwlist, 1, 1, values) < 0) {
+        return NULL;
+    }
+    PyObject *to = values[1];
+    if (to != NULL && to != (PyObject *)&PyDict_Type && to != (PyObject *)&PyList_Type) {
+        PyErr_SetString(PyExc_ValueError, "from_columns to= must be dict or list");
         return NULL;
     }
+    int dictRows = (to != (PyObject *)&PyList_Type);
 
-    return tohil_python_return(self->interp, TCL_OK, self->to, valueObj);
+    PyObject *pItems = PyMapping_Items(values[0]);
+    if (pItems == NULL) {
+        return NULL;
+    }
+    Py_ssize_t nFields = PyList_GET_SIZE(pItems);
+    Py_ssize_t nRows = 0;
+    if (nFields > 0) {
+        nRows = PyObject_Length(PyTuple_GET_ITEM(PyList_GET_ITEM(pItems, 0), 1));
+        if (nRows < 0) {
+            Py_DECREF(pItems);
+            return NULL;
+        }
+    }
+    // the rows make a tcl list, and so do the values of all the columns
+    // while they're gathered, or of each row for to=list
+    if (nRows > TOHIL_LIST_MAX || nFields > TOHIL_LIST_MAX || (nRows > 0 && nFields > TOHIL_LIST_MAX / nRows)) {
+        PyErr_SetString(PyExc_OverflowError, "too many rows or columns for a tcl list");
+        Py_DECREF(pItems);
+        return NULL;
+    }
+
+    // the values, column by column, and the keys, which every row shares
+    Tcl_Obj **valueObjs = (Tcl_Obj **)tohil_AttemptAlloc(sizeof(Tcl_Obj *) * ((size_t)nFields * nRows + 1));
+    if (valueObjs == NULL) {
+        Py_DECREF(pItems);
+        return NULL;
+    }
+    Tcl_Obj **keyObjs = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * (nFields + 1));
+    Py_ssize_t f;
+    for (f = 0; f < nFields; f++) {
+        PyObject *pName = PyTuple_GET_ITEM(PyList_GET_ITEM(pItems, f), 0);
+        keyObjs[f] = _pyObjToTcl(interp, pName);
+        if (keyObjs[f] == NULL) {
+            break;
+        }
+        Tcl_IncrRefCount(keyObjs[f]);
+        if (tohil_ColumnToTcl(interp, pName, PyTuple_GET_ITEM(PyList_GET_ITEM(pItems, f), 1), nRows, &valueObjs[f * nRows]) < 0) {
+            Tcl_DecrRefCount(keyObjs[f]);
+            break;
+        }
+    }
+    Py_DECREF(pItems);
+
+    PyObject *pResult = NULL;
+    Tcl_Obj **rowObjs = NULL;
+    if (f == nFields) {
+        rowObjs = (Tcl_Obj **)tohil_AttemptAlloc(sizeof(Tcl_Obj *) * ((size_t)nRows + 1));
+    }
+    if (rowObjs == NULL) {
+        // free the values of the columns that were converted
+        for (Py_ssize_t i = 0; i < f * nRows; i++) {
+            Tcl_IncrRefCount(valueObjs[i]);
+            Tcl_DecrRefCount(valueObjs[i]);
+        }
+    } else {
+        Tcl_Obj **fieldObjs = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * (nFields + 1));
+        for (Py_ssize_t i = 0; i < nRows; i++) {
+            if (dictRows) {
+                rowObjs[i] = Tcl_NewDictObj();
+                for (Py_ssize_t g = 0; g < nFields; g++) {
+                    Tcl_DictObjPut(NULL, rowObjs[i], keyObjs[g], valueObjs[g * nRows + i]);
+                }
+            } else {
+                for (Py_ssize_t g = 0; g < nFields; g++) {
+                    fieldObjs[g] = valueObjs[g * nRows + i];
+                }
+                rowObjs[i] = Tcl_NewListObj((int)nFields, fieldObjs);
+            }
+        }
+        Tcl_Obj *listObj = Tcl_NewListObj((int)nRows, rowObjs);
+        ckfree((char *)rowObjs);
+        ckfree((char *)fieldObjs);
+
+        pResult = TohilTclObj_FromTclObj(listObj);
+        if (pResult == NULL) {
+            Tcl_IncrRefCount(listObj);
+            Tcl_DecrRefCount(listObj);
+        }
+    }
+
+    for (Py_ssize_t g = 0; g < f; g++) {
+        Tcl_DecrRefCount(keyObjs[g]);
+    }
+    ckfree((char *)keyObjs);
+    ckfree((char *)valueObjs);
+    return pResult;
 }
 
 //
-// TohilTclDict_delitem - removes an item from the tcldict.  if
-//   keys is a python list, treats tcl dict as a hierarchy of
-//   tcl dicts.
+// tohil.getvar - from python get the contents of a variable
 //
-static int
-TohilTclDict_delitem(TohilTclObj *self, PyObject *keys)
+static PyObject *
+tohil_getvar(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    if (PyList_Check(keys)) {
-        int objc = 0;
-        Tcl_Obj **objv = NULL;
-
-        // build up a tcl objv of the keys
-        pyListToTclObjv((PyListObject *)keys, &objc, &objv);
+    static const char *const kwlist[] = {"var", "to", "default", NULL};
+    PyObject *values[3];
+    Tcl_Obj *obj = NULL;
 
-        // we are about to try to modify the object, so if it's shared we need to copy
-        TohilTclObj_dup_if_shared(self);
+    if (tohil_parse_args("getvar", args, nargs, kwnames, kwlist, 1, 1, values) < 0) {
+        return NULL;
+    }
 
-        int status = (Tcl_DictObjRemoveKeyList(self->interp, self->tclobj, objc, objv));
+    PyTypeObject *to = (PyTypeObject *)values[1];
+    PyObject *defaultPyObj = values[2];
+    const char *var = tohil_parse_utf8("getvar", "var", values[0]);
+    if (var == NULL) {
+        return NULL;
+    }
 
-        // tear down the objv of the keys we created
-        pyListToObjv_teardown(objc, objv);
+    if (defaultPyObj == NULL) {
+        // a default wasn't specified, it's an error if the var or array
+        // element doesn't exist
+        obj = Tcl_GetVar2Ex(tcl_interp, var, NULL, (TCL_LEAVE_ERR_MSG));
 
-        if (status == TCL_ERROR) {
-            PyErr_SetString(PyExc_KeyError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-            return -1;
+        if (obj == NULL) {
+            PyErr_SetString(PyExc_NameError, Tcl_GetString(Tcl_GetObjResult(tcl_interp)));
+            return NULL;
         }
     } else {
-        Tcl_Obj *keyObj = _pyObjToTcl(self->interp, keys);
-
-        if (keyObj == NULL) {
-            PyErr_SetString(PyExc_RuntimeError, "unable to fashion argument into a string to be used as a dictionary key");
-            return -1;
+        // a default was specified, it's not an error if the var or array
+        // element doesn't exist, we simply return the default value
+        obj = Tcl_GetVar2Ex(tcl_interp, var, NULL, 0);
+        if (obj == NULL) {
+            // not there but they provided a default
+            if (to == NULL) {
+                // they didn't provide a to= conversion,
+                // give them their default as is
+                Py_INCREF(defaultPyObj);
+                return defaultPyObj;
+            } else {
+                // they provided a to= conversion, run
+                // their python through that and return it.
+                obj = pyObjToTcl(tcl_interp, defaultPyObj);
+            }
         }
+    }
 
-        // we are about to try to modify the object, so if it's shared we need to copy
-        TohilTclObj_dup_if_shared(self);
+    // the var or array element exists in tcl, return the value to python,
+    // possibly to a specific datatype
+    return tohil_python_return(tcl_interp, TCL_OK, to, obj);
+}
+
+//
+// tohil.exists - from python see if a variable or array element exists in tcl
+//
+static PyObject *
+tohil_exists(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"var", NULL};
+    PyObject *values[1];
+
+    if (tohil_parse_args("exists", args, nargs, kwnames, kwlist, 1, 1, values) < 0)
+        return NULL;
+
+    const char *var = tohil_parse_utf8("exists", "var", values[0]);
+    if (var == NULL)
+        return NULL;
 
-        if (Tcl_DictObjRemove(NULL, self->tclobj, keyObj) == TCL_ERROR) {
-            Tcl_DecrRefCount(keyObj);
-            PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
-            return -1;
-        }
-        Tcl_DecrRefCount(keyObj);
-    }
+    Tcl_Obj *obj = Tcl_GetVar2Ex(tcl_interp, var, NULL, 0);
 
-    return 0;
+    PyObject *p = (obj == NULL ? Py_False : Py_True);
+    Py_INCREF(p);
+    return p;
 }
 
 //
-// self.setitem(keys, value) - translates python value object to
-//   tcl and sets it in the tcldict.  if keys is a python list,
-//   treats it as a hierarchy of dictionaries.
+// tohil.setvar - set a variable or array element in tcl from python
 //
-static int
-TohilTclDict_setitem(TohilTclObj *self, PyObject *keys, PyObject *pValue)
+static PyObject *
+tohil_setvar(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    Tcl_Obj *valueObj = pyObjToTcl(self->interp, pValue);
+    static const char *const kwlist[] = {"var", "value", NULL};
+    PyObject *values[2];
 
-    // we are about to try to modify the object, so if it's shared we need to copy
-    TohilTclObj_dup_if_shared(self);
+    if (tohil_parse_args("setvar", args, nargs, kwnames, kwlist, 2, 2, values) < 0)
+        return NULL;
 
-    if (PyList_Check(keys)) {
-        int objc;
-        Tcl_Obj **objv;
+    PyObject *pyValue = values[1];
+    const char *var = tohil_parse_utf8("setvar", "var", values[0]);
+    if (var == NULL)
+        return NULL;
 
-        // build up a tcl objv of the keys
-        pyListToTclObjv((PyListObject *)keys, &objc, &objv);
+    Tcl_Obj *tclValue = pyObjToTcl(tcl_interp, pyValue);
 
-        int status = (Tcl_DictObjPutKeyList(self->interp, self->tclobj, objc, objv, valueObj));
+    Tcl_Obj *obj = Tcl_SetVar2Ex(tcl_interp, var, NULL, tclValue, (TCL_LEAVE_ERR_MSG));
 
-        // tear down the objv of the keys we created
-        pyListToObjv_teardown(objc, objv);
+    if (obj == NULL) {
+        char *errMsg = Tcl_GetString(Tcl_GetObjResult(tcl_interp));
+        PyErr_SetString(PyExc_RuntimeError, errMsg);
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
 
-        if (status == TCL_ERROR) {
-            Tcl_DecrRefCount(valueObj);
-            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
-            return -1;
+//
+// tohil.incr - incr a variable or array element in tcl from python
+//
+static PyObject *
+tohil_incr(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"var", "incr", NULL};
+    PyObject *values[2];
+    long longValue = 0;
+    long increment = 1;
+
+    if (tohil_parse_args("incr", args, nargs, kwnames, kwlist, 1, 2, values) < 0)
+        return NULL;
+
+    const char *var = tohil_parse_utf8("incr", "var", values[0]);
+    if (var == NULL || (values[1] != NULL && tohil_parse_long(values[1], &increment) < 0))
+        return NULL;
+
+    Tcl_Obj *obj = Tcl_GetVar2Ex(tcl_interp, var, NULL, 0);
+    if (obj == NULL) {
+        longValue = increment;
+        obj = Tcl_NewLongObj(longValue);
+        if (Tcl_SetVar2Ex(tcl_interp, var, NULL, obj, (TCL_LEAVE_ERR_MSG)) == NULL) {
+            goto type_error;
         }
     } else {
-        Tcl_Obj *keyObj = _pyObjToTcl(self->interp, keys);
-
-        if (keyObj == NULL) {
-            PyErr_SetString(PyExc_RuntimeError, "unable to fashion argument into a string to be used as a dictionary key");
-            return -1;
+        if (Tcl_GetLongFromObj(tcl_interp, obj, &longValue) == TCL_ERROR) {
+        type_error:
+            PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(tcl_interp)));
+            return NULL;
         }
 
-        if (Tcl_DictObjPut(self->interp, self->tclobj, keyObj, valueObj) == TCL_ERROR) {
-            Tcl_DecrRefCount(keyObj);
-            Tcl_DecrRefCount(valueObj);
-            PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
-            return -1;
+        longValue += increment;
+
+        if (Tcl_IsShared(obj)) {
+            Tcl_DecrRefCount(obj);
+            obj = Tcl_DuplicateObj(obj);
+            Tcl_SetLongObj(obj, longValue);
+            if (Tcl_SetVar2Ex(tcl_interp, var, NULL, obj, (TCL_LEAVE_ERR_MSG)) == NULL) {
+                goto type_error;
+            }
+        } else {
+            Tcl_SetLongObj(obj, longValue);
         }
-        // something about this is a crash
-        // Tcl_DecrRefCount(keyObj);
-        // Tcl_DecrRefCount(valueObj);
     }
+    return PyLong_FromLong(longValue);
+}
 
-    return 0;
+// tohil.unset - from python unset a variable or array element in the tcl
+//   interpreter.  it is not an error if the variable or element doesn't
+//   exist.  if passed the name of an array with no subscripted element,
+//   the entire array is deleted
+static PyObject *
+tohil_unset(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    static const char *const kwlist[] = {"var", NULL};
+    PyObject *values[1];
+
+    if (tohil_parse_args("unset", args, nargs, kwnames, kwlist, 1, 1, values) < 0)
+        return NULL;
+
+    const char *var = tohil_parse_utf8("unset", "var", values[0]);
+    if (var == NULL)
+        return NULL;
+
+    Tcl_UnsetVar(tcl_interp, var, 0);
+    Py_RETURN_NONE;
 }
 
 //
-// tclobj.td_set(key, value) - do a dict set on the tcl object.
-//   if key is a python list, td_set operates on a nested hierarchy
-//   of dictionaries.
+// tohil.subst - perform tcl "subst" substitution on the passed string,
+// evaluating square-bracketed stuff and expanding $-prefaced variables,
+// without evaluating the ultimate result, like eval would
 //
 static PyObject *
-TohilTclDict_td_set(TohilTclObj *self, PyObject *args, PyObject *kwargs)
+tohil_subst(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    static char *kwlist[] = {"key", "value", NULL};
-    PyObject *keys = NULL;
-    PyObject *pValue = NULL;
+    static const char *const kwlist[] = {"string", "to", NULL};
+    PyObject *values[2];
 
-    // remember, "O" sets our pointer to the object without incrementing its reference count
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|$", kwlist, &keys, &pValue)) {
+    if (tohil_parse_args("subst", args, nargs, kwnames, kwlist, 1, 1, values) < 0) {
         return NULL;
     }
 
-    if (TohilTclDict_setitem(self, keys, pValue) < 0) {
+    PyTypeObject *to = (PyTypeObject *)values[1];
+    const char *string = tohil_parse_utf8("subst", "string", values[0]);
+    if (string == NULL) {
+        return NULL;
+    }
+    Tcl_Obj *stringObj = TohilCache_GetTextObj(&substCache, string);
+    Tcl_IncrRefCount(stringObj);
+    Tcl_Obj *obj = Tcl_SubstObj(tcl_interp, stringObj, TCL_SUBST_ALL);
+    Tcl_DecrRefCount(stringObj);
+    if (obj == NULL) {
+        char *errMsg = Tcl_GetString(Tcl_GetObjResult(tcl_interp));
+        PyErr_SetString(PyExc_RuntimeError, errMsg);
         return NULL;
     }
 
-    Py_RETURN_NONE;
+    Tcl_IncrRefCount(obj);
+    PyObject *pRet = tohil_python_return(tcl_interp, TCL_OK, to, obj);
+    Tcl_DecrRefCount(obj);
+    return pRet;
 }
 
 //
-// TohilTclDict_ass_sub() - if a python key object and python value
-//   object are present, set in the tcl dict for the key, the value.
-//
-//   the key may be a list in which case the dictionary is a hierarchy
-//   of dictionaries.
-//
-//   if the value is NULL then deletes the item.
+// tohil_evalobjv - invoke the tcl command in objv, whose elements
+//   the caller has incremented the reference counts of, release the
+//   elements, and return the result to python according to to.
 //
-static int
-TohilTclDict_ass_sub(TohilTclObj *self, PyObject *key, PyObject *val)
+static PyObject *
+tohil_evalobjv(int objc, Tcl_Obj **objv, PyTypeObject *to)
 {
-    if (val == NULL) {
-        return TohilTclDict_delitem(self, key);
-    } else {
-        return TohilTclDict_setitem(self, key, val);
+    int tcl_result = Tcl_EvalObjv(tcl_interp, objc, objv, 0);
+
+    for (int i = 0; i < objc; i++) {
+        Tcl_DecrRefCount(objv[i]);
     }
+
+    return tohil_python_return(tcl_interp, tcl_result, to, Tcl_GetObjResult(tcl_interp));
 }
 
 //
-// TohilTclDict_length() - return the dict size of a python tcldict's
-//   tcl object or set a python error and return -1 if something went wrong.
+// tohil_call_objv - invoke a tcl command whose first prefixc words are
+//   already tcl objects in prefixv, followed by nargs python objects
+//   which are converted to tcl objects, and return the result to python
+//   according to to.
 //
-static Py_ssize_t
-TohilTclDict_length(TohilTclObj *self)
+//   this is the common path for tohil.call, tohil.Script and friends.
+//
+static PyObject *
+tohil_call_objv(int prefixc, Tcl_Obj *const prefixv[], PyObject *const *args, Py_ssize_t nargs, PyTypeObject *to)
 {
-    int length;
-    if (Tcl_DictObjSize(self->interp, self->tclobj, &length) == TCL_OK) {
-        return length;
+    Tcl_Obj *staticObjv[TOHIL_STATIC_OBJV];
+    Tcl_Obj **objv = staticObjv;
+    Py_ssize_t objc = prefixc + nargs;
+    int i;
+
+    // avoid the allocator for the usual small number of arguments
+    if (objc > TOHIL_STATIC_OBJV) {
+        objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
     }
-    PyErr_SetString(PyExc_TypeError, "tclobj contents cannot be converted into a td");
-    return -1;
+
+    for (i = 0; i < prefixc; i++) {
+        objv[i] = prefixv[i];
+        Tcl_IncrRefCount(objv[i]);
+    }
+
+    // for each argument convert the python object to a tcl object
+    // and store it in the tcl object vector
+    for (i = 0; i < nargs; i++) {
+        objv[prefixc + i] = pyObjToTcl(tcl_interp, args[i]);
+        Tcl_IncrRefCount(objv[prefixc + i]);
+    }
+
+    // invoke tcl using the objv array we just constructed
+    PyObject *pRet = tohil_evalobjv(objc, objv, to);
+
+    if (objv != staticObjv) {
+        ckfree(objv);
+    }
+    return pRet;
 }
 
 //
-// TohilTclDict_size() - return a python object containing the dict size
-//   of a python tcldict's tcl object.
-//   returns null i.e. exception thrown if tcl object isn't a proper tcl dict.
+// tohil.call function for python that's like the tohil::call in tcl, something
+// that lets you explicitly specify a tcl command and its arguments and lets
+// you avoid passing everything through eval.  here it is.
 //
 static PyObject *
-TohilTclDict_size(TohilTclObj *self, PyObject *pyobj)
+tohil_call(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
 {
-    int length = TohilTclDict_length(self);
-    if (length < 0) {
+    PyTypeObject *to = NULL;
+
+    if (tohil_parse_to("tohil.call", args, nargs, kwnames, &to) < 0) {
         return NULL;
     }
-    return PyLong_FromLong(length);
+
+    return tohil_call_objv(0, NULL, args, nargs, to);
 }
 
 //
-// TohilTclDictIter() - returns a tcldict iterator object that can
-//   iterate over a tcldict.
+//
+// start of Script python datatype
+//
+// a tohil.Script holds a tcl lambda, {params body}, in the tcl object
+// of an otherwise ordinary tclobj structure.  calling it invokes the
+// lambda using "apply", and tcl caches the compiled lambda in the
+// lambda object's internal rep, so the body is compiled once no matter
+// how many times the script is called.  arguments are passed as
+// separate tcl objects, so there's no quoting or string interpolation.
+//
+//
+
+// a script is a tclobj plus our vectorcall function.  the lambda's
+// params and body are kept too, so looking at them doesn't make the
+// lambda a list and throw away its compiled body.
+typedef struct {
+    TohilTclObj tclobj;
+    tohil_vectorcallfunc vectorcall;
+    Tcl_Obj *paramsObj;
+    Tcl_Obj *bodyObj;
+} TohilScript;
+
+static PyObject *TohilScript_vectorcall(PyObject *self, PyObject *const *args, size_t nargsf, PyObject *kwnames);
+
+// the "apply" command name, shared by all scripts so tcl's
+// command resolution gets cached in it
+static Tcl_Obj *applyCmdObj = NULL;
+
+//
+// create a new python Script object from a tcl script body and
+//   optional parameter list and namespace
 //
 static PyObject *
-TohilTclDictIter(TohilTclObj *self)
+TohilScript_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
 {
-    // printf("TohilTclDictIter\n");
-    // we don't need size but we use this to make tclobj is or can be a dict
-    int size = 0;
-    if (Tcl_DictObjSize(self->interp, self->tclobj, &size) == TCL_ERROR) {
-        PyErr_Format(PyExc_TypeError, "tclobj contents cannot be converted into a td");
+    static char *kwlist[] = {"body", "params", "to", "namespace", NULL};
+    PyObject *pBody = NULL;
+    PyObject *pParams = NULL;
+    PyObject *toType = NULL;
+    PyObject *pNamespace = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "U|O$OU", kwlist, &pBody, &pParams, &toType, &pNamespace)) {
         return NULL;
     }
 
-    PyTohil_TD_IterObj *pIter = (PyTohil_TD_IterObj *)PyObject_New(PyTohil_TD_IterObj, &PyTohil_TD_IterType);
+    if (toType != NULL && toType != Py_None && !PyType_Check(toType)) {
+        PyErr_SetString(PyExc_RuntimeError, "to type is not a valid python data type");
+        return NULL;
+    }
 
-    pIter->interp = self->interp;
-    pIter->started = 0;
-    pIter->done = 0;
-    pIter->to = self->to;
-    Py_XINCREF(pIter->to);
+    Tcl_Obj *lambdaObj = Tcl_NewListObj(0, NULL);
+    Tcl_Obj *paramsObj = (pParams == NULL) ? Tcl_NewObj() : pyObjToTcl(tcl_interp, pParams);
 
-    memset((void *)&pIter->search, 0, sizeof(Tcl_DictSearch));
+    // make sure the parameter list is a list now rather than when we're first called
+    int nParams;
+    if (Tcl_ListObjLength(tcl_interp, paramsObj, &nParams) == TCL_ERROR) {
+        PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(tcl_interp)));
+        Tcl_DecrRefCount(lambdaObj);
+        Tcl_IncrRefCount(paramsObj);
+        Tcl_DecrRefCount(paramsObj);
+        return NULL;
+    }
 
-    pIter->dictObj = ((TohilTclObj *)self)->tclobj;
-    Tcl_IncrRefCount(pIter->dictObj);
+    Tcl_Obj *bodyObj = pyObjToTcl(tcl_interp, pBody);
+    Tcl_ListObjAppendElement(tcl_interp, lambdaObj, paramsObj);
+    Tcl_ListObjAppendElement(tcl_interp, lambdaObj, bodyObj);
+    if (pNamespace != NULL) {
+        Tcl_ListObjAppendElement(tcl_interp, lambdaObj, pyObjToTcl(tcl_interp, pNamespace));
+    }
 
-    return (PyObject *)pIter;
+    TohilTclObj *self = (TohilTclObj *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        Tcl_DecrRefCount(lambdaObj);
+        return NULL;
+    }
+    ((TohilScript *)self)->vectorcall = TohilScript_vectorcall;
+    ((TohilScript *)self)->paramsObj = paramsObj;
+    Tcl_IncrRefCount(paramsObj);
+    ((TohilScript *)self)->bodyObj = bodyObj;
+    Tcl_IncrRefCount(bodyObj);
+
+    if (applyCmdObj == NULL) {
+        applyCmdObj = Tcl_NewStringObj("::apply", -1);
+        Tcl_IncrRefCount(applyCmdObj);
+    }
+
+    self->interp = tcl_interp;
+    self->tclobj = lambdaObj;
+    Tcl_IncrRefCount(self->tclobj);
+    self->to = (toType == Py_None) ? NULL : (PyTypeObject *)toType;
+    Py_XINCREF(self->to);
+    return (PyObject *)self;
 }
 
 //
-// TohilTclDict_Contains - return 0 if key or keys is not
-//   contained in tcldict, 1 if it is, or -1 if there was
-//   an error.
+// deallocate function for python Script type
 //
-static int
-TohilTclDict_Contains(PyObject *self, PyObject *keys)
+static void
+TohilScript_dealloc(TohilScript *self)
 {
-    // printf("TohilTclDict_Contains\n");
-    Tcl_Obj *valueObj = TohilTclDict_td_locate((TohilTclObj *)self, keys);
-    if (valueObj == NULL) {
-        if (PyErr_Occurred() != NULL) {
-            return -1;
-        }
-        return 0;
-    }
-    return 1;
+    Tcl_DecrRefCount(self->paramsObj);
+    Tcl_DecrRefCount(self->bodyObj);
+    TohilTclObj_dealloc((TohilTclObj *)self);
 }
 
-static PyMappingMethods TohilTclDict_as_mapping = {(lenfunc)TohilTclDict_length, (binaryfunc)TohilTclDict_subscript,
-                                                   (objobjargproc)TohilTclDict_ass_sub};
+//
+// call a Script object.  positional arguments are passed to the script's
+//   parameters in order.  to= can override the script's default to type.
+//
+static PyObject *
+TohilScript_vectorcall(PyObject *pSelf, PyObject *const *args, size_t nargsf, PyObject *kwnames)
+{
+    TohilTclObj *self = (TohilTclObj *)pSelf;
+    Py_ssize_t nargs = TOHIL_NARGS(nargsf);
+    PyTypeObject *to = self->to;
 
-static PySequenceMethods TohilTclDict_as_sequence = {
-    .sq_contains = TohilTclDict_Contains,
-};
+    if (tohil_parse_to("tohil.Script", args, nargs, kwnames, &to) < 0) {
+        return NULL;
+    }
 
-static PyMethodDef TohilTclDict_methods[] = {
-    {"get", (PyCFunction)TohilTclDict_td_get, METH_VARARGS | METH_KEYWORDS, "get from tcl dict"},
-    // NB i don't know if this __len__ thing works -- python might
-    // be doing something gross to get the len of the dict, like
-    // enumerating the elements
-    {"__len__", (PyCFunction)TohilTclDict_size, METH_VARARGS | METH_KEYWORDS, "get length of tcl dict"},
-    {"td_set", (PyCFunction)TohilTclDict_td_set, METH_VARARGS | METH_KEYWORDS, "set item in tcl dict"},
-    {"getvar", (PyCFunction)TohilTclObj_getvar, METH_O, "set tclobj to tcl var or array element"},
-    {"setvar", (PyCFunction)TohilTclObj_setvar, METH_O, "set tcl var or array element to tclobj's tcl object"},
-    {"set", (PyCFunction)TohilTclObj_set, METH_O, "set tclobj from some python object"},
-    {NULL} // sentinel
-};
+    Tcl_Obj *prefixv[2] = {applyCmdObj, self->tclobj};
+    return tohil_call_objv(2, prefixv, args, nargs, to);
+}
+
+#ifndef TOHIL_VECTORCALL
+static PyObject *
+TohilScript_call(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    return tohil_tp_call(TohilScript_vectorcall, self, args, kwargs);
+}
+#endif
 
-// NB need to change tp_itr, to_as_squence, to_as_mapping to do dict stuff
+//
+// Script.params and Script.body - the parts of the script's lambda
+//
+static PyObject *
+TohilScript_params(TohilScript *self, void *closure)
+{
+    return tohil_python_return(self->tclobj.interp, TCL_OK, NULL, self->paramsObj);
+}
 
-static PyTypeObject TohilTclDictType = {
-    PyVarObject_HEAD_INIT(NULL, 0)
-        // .tp_base = &TohilTclObjType, NB - len() breaks when we inherit
-        .tp_name = "tohil.tcldict",
-    .tp_doc = "Tcl TD tcldict Object",
-    .tp_basicsize = sizeof(TohilTclObj),
+static PyObject *
+TohilScript_body(TohilScript *self, void *closure)
+{
+    return tohil_python_return(self->tclobj.interp, TCL_OK, NULL, self->bodyObj);
+}
+
+static PyGetSetDef TohilScript_getsetters[] = {
+    {"to", (getter)TohilTclObj_getto, (setter)TohilTclObj_setto, "python type to default returns to", NULL},
+    {"params", (getter)TohilScript_params, NULL, "the script's parameter list", NULL},
+    {"body", (getter)TohilScript_body, NULL, "the script's body", NULL},
+    {NULL}};
+
+static PyTypeObject TohilScriptType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "tohil.Script",
+    .tp_doc = "Precompiled Tcl script with parameters",
+    .tp_basicsize = sizeof(TohilScript),
     .tp_itemsize = 0,
+#ifdef TOHIL_VECTORCALL
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_VECTORCALL,
+    .tp_vectorcall_offset = offsetof(TohilScript, vectorcall),
+    .tp_call = PyVectorcall_Call,
+#else
     .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
-    .tp_new = TohilTclObj_new,
-    .tp_init = (initproc)TohilTclObj_init,
-    .tp_dealloc = (destructor)TohilTclObj_dealloc,
-    .tp_methods = TohilTclDict_methods,
+    .tp_call = TohilScript_call,
+#endif
+    .tp_new = TohilScript_new,
+    .tp_dealloc = (destructor)TohilScript_dealloc,
     .tp_str = (reprfunc)TohilTclObj_str,
-    .tp_iter = (getiterfunc)TohilTclDictIter,
-    .tp_as_mapping = &TohilTclDict_as_mapping,
-    .tp_as_sequence = &TohilTclDict_as_sequence,
     .tp_repr = (reprfunc)TohilTclObj_repr,
-    .tp_richcompare = (richcmpfunc)TohilTclObj_richcompare,
-    .tp_getset = TohilTclObj_getsetters,
+    .tp_getset = TohilScript_getsetters,
 };
 
 //
 //
-// end of tcldict python datatype
+// end of Script python datatype
 //
 //
 
-// tohil_python_return - you call this routine when you have a tcl object
-//   that you want to turn into a python object.  usually you call it when
-//   you are returning from a C function called from python, but it is
-//   used repeatedly in TohilTclObj_slice to prepare a list of python objects
-//   converted from tcl objects.
 //
-//   this code is called  a lot.  it also can return tcl errors, and it
-//   can convert the tcl object to a specific python type if the "to" type
-//   is not null.  (If null the conversion type defaults to str.)
 //
-// NB these strcmps could be replaced by more efficient direct
-// address comparisons if you grabbed the addresses of the type objects
-// we are insterested in compared to them
+// start of command python datatype
+//
+// a tohil.command is a handle on a tcl command, created from its name.
+// calling it invokes the command with the arguments passed as separate
+// tcl objects, with no quoting or string interpolation.
+//
+// the command's fully qualified name is kept in a tcl object that we
+// always invoke the command through, so tcl caches the resolved command
+// in it and doesn't have to look the name up through the namespaces
+// on every call.
+//
+// we also hold the command's token and put a command trace on it, so
+// if the command is renamed we follow it to its new name, and if it's
+// deleted we notice.  a deleted command is looked up by name again the
+// next time the handle is called, so redefining a proc works, and if
+// it's still gone, NameError is raised.
+//
 //
-PyObject *
-tohil_python_return(Tcl_Interp *interp, int tcl_result, PyTypeObject *toType, Tcl_Obj *resultObj)
-{
-    const char *toString = NULL;
-    PyTypeObject *pt = NULL;
 
-    if (PyErr_Occurred() != NULL) {
-        // printf("tohil_python_return invoked with a python error already present\n");
-        // return NULL;
-    }
+typedef struct {
+    PyObject_HEAD;
+    PyTypeObject *to;
+    Tcl_Interp *interp;
+    Tcl_Obj *nameObj;
+    Tcl_Command token;
+    tohil_vectorcallfunc vectorcall;
+} TohilCommand;
 
-    if (tcl_result == TCL_ERROR) {
-        // dig out tcl error information and create a tohil tcldict containing it
-        // (Tcl_GetReturnOptions returns a tcl dict object)
-        Tcl_Obj *returnOptionsObj = Tcl_GetReturnOptions(interp, tcl_result);
-        PyObject *pReturnOptionsObj = TohilTclDict_FromTclObj(returnOptionsObj);
+static PyObject *TohilCommand_vectorcall(PyObject *self, PyObject *const *args, size_t nargsf, PyObject *kwnames);
 
-        // construct a two-element tuple comprising the interpreter result
-        // and the tcldict containing the info grabbed from tcl
-        PyObject *pRetTuple = PyTuple_New(2);
-        int tclStringSize;
-        char *tclString;
-        tclString = Tcl_GetStringFromObj(resultObj, &tclStringSize);
-        PyTuple_SET_ITEM(pRetTuple, 0, Py_BuildValue("s#", tclString, tclStringSize));
-        PyTuple_SET_ITEM(pRetTuple, 1, pReturnOptionsObj);
+#define TOHIL_COMMAND_TRACE_FLAGS (TCL_TRACE_RENAME | TCL_TRACE_DELETE)
 
-        // ...and set the python error object to
-        // TclError(interp_result_string, tcldict_object)
-        PyErr_SetObject(pTohilTclErrorClass, pRetTuple);
-        return NULL;
+//
+// command trace proc - follow the command if it's renamed,
+//   forget about it if it's deleted
+//
+static void
+TohilCommand_Trace(ClientData clientData, Tcl_Interp *interp, const char *oldName, const char *newName, int flags)
+{
+    TohilCommand *self = (TohilCommand *)clientData;
+
+    if (flags & TCL_TRACE_DESTROYED || newName == NULL || *newName == '\0') {
+        // tcl removes the trace itself once the command is deleted
+        self->token = NULL;
+        return;
     }
 
-    if (toType != NULL) {
-        if (!PyType_Check(toType)) {
-            PyErr_SetString(PyExc_RuntimeError, "to type is not a valid python data type");
-            return NULL;
-        }
+    // the rename has already happened, so ask tcl for the full new name
+    Tcl_Obj *newNameObj = Tcl_NewObj();
+    Tcl_GetCommandFullName(interp, self->token, newNameObj);
+    Tcl_IncrRefCount(newNameObj);
+    Tcl_DecrRefCount(self->nameObj);
+    self->nameObj = newNameObj;
+}
 
-        // toType/pt is a borrowed reference; do not decrement its reference count
-        pt = (PyTypeObject *)toType;
-        toString = pt->tp_name;
+//
+// TohilCommand_Attach - look up the command named by the handle's
+//   name object, switch the name to the command's fully qualified
+//   name, and put a trace on the command.
+//
+//   returns 0 on success, or -1 with a python exception set
+//
+static int
+TohilCommand_Attach(TohilCommand *self)
+{
+    Tcl_Command token = Tcl_GetCommandFromObj(self->interp, self->nameObj);
+    if (token == NULL) {
+        PyErr_Format(PyExc_NameError, "invalid command name \"%s\"", Tcl_GetString(self->nameObj));
+        return -1;
     }
-    // printf("tohil_python_return called: tcl result %d, to=%s, resulObj '%s'\n", tcl_result, toString, Tcl_GetString(resultObj));
 
-    if (toType == NULL || STREQU(toString, "str")) {
-        int tclStringSize;
-        char *tclString;
-        int utf8len;
-        char *utf8string;
+    Tcl_Obj *fullNameObj = Tcl_NewObj();
+    Tcl_GetCommandFullName(self->interp, token, fullNameObj);
+    Tcl_IncrRefCount(fullNameObj);
 
-        tclString = Tcl_GetStringFromObj(resultObj, &tclStringSize);
-        if (tohil_TclToUTF8(tclString, tclStringSize, &utf8string, &utf8len) != TCL_OK) {
-            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
-            return NULL;
-        }
-        PyObject *pObj = Py_BuildValue("s#", utf8string, utf8len);
-        ckfree(utf8string);
-        return pObj;
+    if (Tcl_TraceCommand(self->interp, Tcl_GetString(fullNameObj), TOHIL_COMMAND_TRACE_FLAGS, TohilCommand_Trace, self) != TCL_OK) {
+        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(self->interp)));
+        Tcl_DecrRefCount(fullNameObj);
+        return -1;
     }
 
-    if (STREQU(toString, "int")) {
-        long longValue;
+    Tcl_DecrRefCount(self->nameObj);
+    self->nameObj = fullNameObj;
+    self->token = token;
+    return 0;
+}
 
-        if (Tcl_GetLongFromObj(interp, resultObj, &longValue) == TCL_OK) {
-            return PyLong_FromLong(longValue);
-        }
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+//
+// create a new python command object from a tcl command name
+//
+static PyObject *
+TohilCommand_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"name", "to", NULL};
+    PyObject *pName = NULL;
+    PyObject *toType = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "U|$O", kwlist, &pName, &toType)) {
         return NULL;
     }
 
-    if (STREQU(toString, "bool")) {
-        int boolValue;
+    if (toType != NULL && toType != Py_None && !PyType_Check(toType)) {
+        PyErr_SetString(PyExc_RuntimeError, "to type is not a valid python data type");
+        return NULL;
+    }
 
-        if (Tcl_GetBooleanFromObj(interp, resultObj, &boolValue) == TCL_OK) {
-            PyObject *p = (boolValue ? Py_True : Py_False);
-            Py_INCREF(p);
-            return p;
-        }
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+    TohilCommand *self = (TohilCommand *)type->tp_alloc(type, 0);
+    if (self == NULL) {
         return NULL;
     }
 
-    if (STREQU(toString, "float")) {
-        double doubleValue;
+    self->interp = tcl_interp;
+    self->token = NULL;
+    self->vectorcall = TohilCommand_vectorcall;
+    self->nameObj = pyObjToTcl(tcl_interp, pName);
+    Tcl_IncrRefCount(self->nameObj);
+    self->to = (toType == NULL || toType == Py_None) ? NULL : (PyTypeObject *)toType;
+    Py_XINCREF(self->to);
 
-        if (Tcl_GetDoubleFromObj(interp, resultObj, &doubleValue) == TCL_OK) {
-            return PyFloat_FromDouble(doubleValue);
-        }
-        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+    if (TohilCommand_Attach(self) < 0) {
+        Py_DECREF(self);
         return NULL;
     }
+    return (PyObject *)self;
+}
 
-    if (STREQU(toString, "tohil.tclobj")) {
-        return TohilTclObj_FromTclObj(resultObj);
+static void
+TohilCommand_dealloc(TohilCommand *self)
+{
+    if (self->token != NULL) {
+        Tcl_UntraceCommand(self->interp, Tcl_GetString(self->nameObj), TOHIL_COMMAND_TRACE_FLAGS, TohilCommand_Trace, self);
     }
+    Tcl_DecrRefCount(self->nameObj);
+    Py_XDECREF(self->to);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
 
-    if (STREQU(toString, "tohil.tcldict")) {
-        return TohilTclDict_FromTclObj(resultObj);
-    }
+//
+// call a command object.  positional arguments are passed to the
+//   command in order.  to= can override the command's default to type.
+//
+static PyObject *
+TohilCommand_vectorcall(PyObject *pSelf, PyObject *const *args, size_t nargsf, PyObject *kwnames)
+{
+    TohilCommand *self = (TohilCommand *)pSelf;
+    Py_ssize_t nargs = TOHIL_NARGS(nargsf);
+    PyTypeObject *to = self->to;
 
-    if (STREQU(toString, "list")) {
-        return tclListObjToPyListObject(interp, resultObj);
+    if (tohil_parse_to("tohil.command", args, nargs, kwnames, &to) < 0) {
+        return NULL;
     }
 
-    if (STREQU(toString, "set")) {
-        return tclListObjToPySetObject(interp, resultObj);
+    // the command was deleted since we last looked, see if it's been redefined
+    if (self->token == NULL && TohilCommand_Attach(self) < 0) {
+        return NULL;
     }
 
-    if (STREQU(toString, "dict")) {
-        return tclListObjToPyDictObject(interp, resultObj);
-    }
+    return tohil_call_objv(1, &self->nameObj, args, nargs, to);
+}
+
+#ifndef TOHIL_VECTORCALL
+static PyObject *
+TohilCommand_call(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    return tohil_tp_call(TohilCommand_vectorcall, self, args, kwargs);
+}
+#endif
+
+static PyObject *
+TohilCommand_name(TohilCommand *self, void *closure)
+{
+    return tohil_python_return(self->interp, TCL_OK, NULL, self->nameObj);
+}
 
-    if (STREQU(toString, "tuple")) {
-        return tclListObjToPyTupleObject(interp, resultObj);
+static PyObject *
+TohilCommand_exists(TohilCommand *self, void *closure)
+{
+    if (self->token != NULL) {
+        Py_RETURN_TRUE;
     }
+    return PyBool_FromLong(Tcl_FindCommand(self->interp, Tcl_GetString(self->nameObj), NULL, TCL_GLOBAL_ONLY) != NULL);
+}
 
-    PyErr_SetString(PyExc_RuntimeError, "'to' conversion type must be str, int, bool, float, list, set, dict, tuple, tohil.tclobj or tohil.tcldict");
-    return NULL;
+static PyObject *
+TohilCommand_repr(TohilCommand *self)
+{
+    Tcl_DString ds;
+    char *utf8string = tohil_TclObjToUTF8(self->nameObj, &ds);
+    PyObject *repr = PyUnicode_FromFormat("<%s: '%s'>", Py_TYPE(self)->tp_name, utf8string);
+    Tcl_DStringFree(&ds);
+    return repr;
 }
 
+static PyGetSetDef TohilCommand_getsetters[] = {
+    {"to", (getter)TohilTclObj_getto, (setter)TohilTclObj_setto, "python type to default returns to", NULL},
+    {"name", (getter)TohilCommand_name, NULL, "fully qualified name of the tcl command", NULL},
+    {"exists", (getter)TohilCommand_exists, NULL, "true if the tcl command currently exists", NULL},
+    {NULL}};
+
+static PyTypeObject TohilCommandType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "tohil.command",
+    .tp_doc = "Handle for calling a Tcl command",
+    .tp_basicsize = sizeof(TohilCommand),
+    .tp_itemsize = 0,
+#ifdef TOHIL_VECTORCALL
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_VECTORCALL,
+    .tp_vectorcall_offset = offsetof(TohilCommand, vectorcall),
+    .tp_call = PyVectorcall_Call,
+#else
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_call = TohilCommand_call,
+#endif
+    .tp_new = TohilCommand_new,
+    .tp_dealloc = (destructor)TohilCommand_dealloc,
+    .tp_repr = (reprfunc)TohilCommand_repr,
+    .tp_getset = TohilCommand_getsetters,
+};
+
 //
-// tohil.eval command for python to eval code in the tcl interpreter
+//
+// end of command python datatype
+//
+//
+
+//
+//
+// start of TclProc python datatype
+//
+// a TclProc makes a tcl proc or C command callable from python like a
+// python function.  for procs we use tcl's introspection to get the
+// proc's parameters and their defaults when the TclProc is created,
+// and precompute a map from parameter names to argument positions, so
+// python positional and keyword arguments, and tcl's special trailing
+// "args" parameter, can be bound straight into the tcl objv at call
+// time.  the proc is invoked through a tcl object holding its name,
+// so tcl caches the command lookup.
+//
+// C commands don't have introspectable arguments so everything is
+// passed through positionally.
+//
+// a rename/delete command trace marks the TclProc stale if its command
+// goes away, which is also what happens when a proc is redefined, and
+// the next call introspects the command by that name all over again.
+//
+//
+
+typedef struct {
+    PyObject_HEAD;
+    PyTypeObject *to;
+    Tcl_Interp *interp;
+    Tcl_Obj *procObj;
+    PyObject *proc;
+    PyObject *functionName;
+    int isProc;
+    // the rest are only set up for procs
+    PyObject *procArgs;
+    PyObject *defaults;
+    PyObject *slotMap;
+    int nSlots;
+    int hasArgs;
+    Tcl_Obj **defaultObjs;
+    // the command we introspected and put a trace on, if it existed
+    Tcl_Command token;
+    int stale;
+    tohil_vectorcallfunc vectorcall;
+} TohilTclProc;
+
+static PyObject *TohilTclProc_vectorcall(PyObject *self, PyObject *const *args, size_t nargsf, PyObject *kwnames);
+
+static void TohilTclProc_Trace(ClientData clientData, Tcl_Interp *interp, const char *oldName, const char *newName, int flags);
+
+//
+// TohilTclProc_function_name - convert a tcl proc name to a python
+//   function name.  take the part after the last ::, then since python
+//   doesn't like dashes or colons in function names, map them to
+//   underscores, and map some other characters that appear in tcl proc
+//   names out there to other stuff.  tcl is too permissive, i feel like.
 //
 static PyObject *
-tohil_eval(PyObject *self, PyObject *args, PyObject *kwargs)
+TohilTclProc_function_name(Tcl_Obj *procObj)
 {
-    static char *kwlist[] = {"tcl_code", "to", NULL};
-    PyTypeObject *to = NULL;
-    char *utf8Code = NULL;
+    int length;
+    const char *proc = Tcl_GetStringFromObj(procObj, &length);
+    const char *tail = proc;
+    Tcl_DString ds;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$O", kwlist, &utf8Code, &to))
-        return NULL;
+    for (const char *p = proc; p + 1 < proc + length; p++) {
+        if (p[0] == ':' && p[1] == ':') {
+            tail = p + 2;
+        }
+    }
 
-    // TODO modify the above PyArg_ParseTupleAndKeywords to return a length?
-    Tcl_DString ds;
-    char *tclCode = tohil_UTF8ToTcl(utf8Code, -1, &ds);
-    int result = Tcl_Eval(tcl_interp, tclCode);
+    Tcl_DStringInit(&ds);
+    for (const char *p = tail; p < proc + length; p++) {
+        switch (*p) {
+        case '-':
+        case ':':
+            Tcl_DStringAppend(&ds, "_", 1);
+            break;
+        case '?':
+            Tcl_DStringAppend(&ds, "_question_mark", -1);
+            break;
+        case '+':
+            Tcl_DStringAppend(&ds, "_plus_sign", -1);
+            break;
+        case '<':
+            Tcl_DStringAppend(&ds, "_less_than", -1);
+            break;
+        case '@':
+            Tcl_DStringAppend(&ds, "_at_sign", -1);
+            break;
+        case '>':
+            Tcl_DStringAppend(&ds, "_greater_than", -1);
+            break;
+        default:
+            Tcl_DStringAppend(&ds, p, 1);
+            break;
+        }
+    }
+
+    Tcl_Obj *functionObj = Tcl_NewStringObj(Tcl_DStringValue(&ds), Tcl_DStringLength(&ds));
     Tcl_DStringFree(&ds);
-    Tcl_Obj *resultObj = Tcl_GetObjResult(tcl_interp);
+    Tcl_IncrRefCount(functionObj);
+    PyObject *pFunction = tohil_python_return(tcl_interp, TCL_OK, NULL, functionObj);
+    Tcl_DecrRefCount(functionObj);
+    return pFunction;
+}
 
-    return tohil_python_return(tcl_interp, result, to, resultObj);
+//
+// TohilTclProc_attach - put our trace on the command the TclProc names,
+//   if there is one
+//
+static void
+TohilTclProc_attach(TohilTclProc *self)
+{
+    self->stale = 0;
+    self->token = Tcl_GetCommandFromObj(self->interp, self->procObj);
+    if (self->token != NULL) {
+        Tcl_Obj *fullNameObj = Tcl_NewObj();
+        Tcl_IncrRefCount(fullNameObj);
+        Tcl_GetCommandFullName(self->interp, self->token, fullNameObj);
+        if (Tcl_TraceCommand(self->interp, Tcl_GetString(fullNameObj), TOHIL_COMMAND_TRACE_FLAGS, TohilTclProc_Trace, self) != TCL_OK) {
+            self->token = NULL;
+        }
+        Tcl_DecrRefCount(fullNameObj);
+    }
 }
 
 //
-// tohil.expr command for python to evaluate expressions using the tcl interpreter
+// TohilTclProc_set_signature - set up a TclProc for a proc with the
+//   parameter names in the sequence pProcArgs, and the defaults in the
+//   dict pDefaults, building the slot map and default tcl objects
 //
-static PyObject *
-tohil_expr(PyObject *self, PyObject *args, PyObject *kwargs)
+//   returns 0 on success, or -1 with a python exception set
+//
+static int
+TohilTclProc_set_signature(TohilTclProc *self, PyObject *pProcArgs, PyObject *pDefaults)
 {
-    static char *kwlist[] = {"expression", "to", NULL};
-    char *utf8expression = NULL;
-    PyTypeObject *to = NULL;
+    Py_ssize_t i;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$O", kwlist, &utf8expression, &to))
-        return NULL;
+    if (pDefaults != NULL && pDefaults != Py_None && !PyDict_Check(pDefaults)) {
+        PyErr_SetString(PyExc_TypeError, "defaults must be a dict");
+        return -1;
+    }
 
-    Tcl_DString ds;
-    char *expression = tohil_UTF8ToTcl(utf8expression, -1, &ds);
+    self->procArgs = PySequence_List(pProcArgs);
+    self->defaults = (pDefaults == NULL || pDefaults == Py_None) ? PyDict_New() : PyDict_Copy(pDefaults);
+    self->slotMap = PyDict_New();
+    if (self->procArgs == NULL || self->defaults == NULL || self->slotMap == NULL) {
+        return -1;
+    }
 
-    Tcl_Obj *resultObj = NULL;
-    if (Tcl_ExprObj(tcl_interp, Tcl_NewStringObj(expression, -1), &resultObj) == TCL_ERROR) {
-        char *errMsg = Tcl_GetString(Tcl_GetObjResult(tcl_interp));
-        PyErr_SetString(PyExc_RuntimeError, errMsg);
-        return NULL;
+    Py_ssize_t nParams = PyList_GET_SIZE(self->procArgs);
+    for (i = 0; i < nParams; i++) {
+        PyObject *pName = PyList_GET_ITEM(self->procArgs, i);
+        if (!PyUnicode_Check(pName)) {
+            PyErr_SetString(PyExc_TypeError, "proc_args must be a sequence of str");
+            return -1;
+        }
+        Py_INCREF(pName);
+        PyUnicode_InternInPlace(&pName);
+        PyList_SetItem(self->procArgs, i, pName);
+    }
+
+    self->isProc = 1;
+    self->hasArgs = (nParams > 0 && PyUnicode_CompareWithASCIIString(PyList_GET_ITEM(self->procArgs, nParams - 1), "args") == 0);
+    self->nSlots = nParams - self->hasArgs;
+    self->defaultObjs = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * (self->nSlots + 1));
+    for (i = 0; i < self->nSlots; i++) {
+        self->defaultObjs[i] = NULL;
     }
 
-    return tohil_python_return(tcl_interp, TCL_OK, to, resultObj);
+    for (i = 0; i < self->nSlots; i++) {
+        PyObject *pName = PyList_GET_ITEM(self->procArgs, i);
+        PyObject *pSlot = PyLong_FromSsize_t(i);
+        if (pSlot == NULL || PyDict_SetItem(self->slotMap, pName, pSlot) < 0) {
+            Py_XDECREF(pSlot);
+            return -1;
+        }
+        Py_DECREF(pSlot);
+
+        PyObject *pDefault = PyDict_GetItemWithError(self->defaults, pName);
+        if (pDefault != NULL) {
+            self->defaultObjs[i] = pyObjToTcl(self->interp, pDefault);
+            Tcl_IncrRefCount(self->defaultObjs[i]);
+        } else if (PyErr_Occurred()) {
+            return -1;
+        }
+    }
+    return 0;
 }
 
 //
-// tohil.convert command for python to pass a python object through
-// to a tcl object and then convert it to a to= destination type
+// TohilTclProc_introspect - figure out if the TclProc's target is a proc
+//   and if so, get its parameters and their defaults and build the slot map
 //
-static PyObject *
-tohil_convert(PyObject *self, PyObject *args, PyObject *kwargs)
+//   returns 0 on success, or -1 with a python exception set
+//
+static int
+TohilTclProc_introspect(TohilTclProc *self)
 {
-    static char *kwlist[] = {"pyobject", "to", NULL};
-    PyObject *pyInputObject = NULL;
-    PyTypeObject *to = NULL;
+    Tcl_Interp *interp = self->interp;
+    Tcl_Obj *objv[3];
+    PyObject *pProcArgs = NULL;
+    PyObject *pDefaults = NULL;
+    int ret = -1;
+    int i;
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|$O", kwlist, &pyInputObject, &to))
-        return NULL;
+    TohilTclProc_attach(self);
 
-    Tcl_Obj *interimObj = pyObjToTcl(tcl_interp, pyInputObject);
-    if (interimObj == NULL) {
-        return NULL;
+    objv[0] = Tcl_NewStringObj("info", -1);
+    objv[1] = Tcl_NewStringObj("args", -1);
+    objv[2] = self->procObj;
+    for (i = 0; i < 3; i++) {
+        Tcl_IncrRefCount(objv[i]);
     }
+    int tcl_result = Tcl_EvalObjv(interp, 3, objv, TCL_EVAL_GLOBAL);
+    Tcl_DecrRefCount(objv[0]);
+    Tcl_DecrRefCount(objv[1]);
 
-    return tohil_python_return(tcl_interp, TCL_OK, to, interimObj);
+    if (tcl_result == TCL_ERROR) {
+        // not a proc, it's a C command (or nothing at all)
+        Tcl_ResetResult(interp);
+        Tcl_DecrRefCount(objv[2]);
+        self->isProc = 0;
+        return 0;
+    }
+
+    Tcl_Obj *argsObj = Tcl_GetObjResult(interp);
+    Tcl_IncrRefCount(argsObj);
+    Tcl_Obj **paramv;
+    int nParams;
+    if (Tcl_ListObjGetElements(interp, argsObj, &nParams, &paramv) == TCL_ERROR) {
+        PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+        goto done;
+    }
+
+    pProcArgs = PyList_New(nParams);
+    pDefaults = PyDict_New();
+    if (pProcArgs == NULL || pDefaults == NULL) {
+        goto done;
+    }
+
+    // safe_info_default proc arg
+    objv[0] = Tcl_NewStringObj("::safe_info_default", -1);
+    Tcl_IncrRefCount(objv[0]);
+    objv[1] = objv[2];
+
+    for (i = 0; i < nParams; i++) {
+        PyObject *pName = tohil_python_return(interp, TCL_OK, NULL, paramv[i]);
+        if (pName == NULL) {
+            break;
+        }
+        PyList_SET_ITEM(pProcArgs, i, pName);
+
+        // safe_info_default returns a list of whether there is a default and what it is
+        objv[2] = paramv[i];
+        tcl_result = Tcl_EvalObjv(interp, 3, objv, TCL_EVAL_GLOBAL);
+        objv[2] = objv[1];
+
+        Tcl_Obj *hasDefaultObj = NULL;
+        Tcl_Obj *defaultObj = NULL;
+        int hasDefault = 0;
+        Tcl_Obj *resultObj = Tcl_GetObjResult(interp);
+        if (tcl_result == TCL_ERROR || Tcl_ListObjIndex(interp, resultObj, 0, &hasDefaultObj) == TCL_ERROR ||
+            Tcl_ListObjIndex(interp, resultObj, 1, &defaultObj) == TCL_ERROR || hasDefaultObj == NULL || defaultObj == NULL ||
+            Tcl_GetBooleanFromObj(interp, hasDefaultObj, &hasDefault) == TCL_ERROR) {
+            PyErr_SetString(PyExc_RuntimeError, Tcl_GetString(Tcl_GetObjResult(interp)));
+            break;
+        }
+
+        if (hasDefault) {
+            PyObject *pDefault = tohil_python_return(interp, TCL_OK, NULL, defaultObj);
+            if (pDefault == NULL || PyDict_SetItem(pDefaults, pName, pDefault) < 0) {
+                Py_XDECREF(pDefault);
+                break;
+            }
+            Py_DECREF(pDefault);
+        }
+    }
+    Tcl_DecrRefCount(objv[0]);
+
+    if (i == nParams) {
+        ret = TohilTclProc_set_signature(self, pProcArgs, pDefaults);
+    }
+
+done:
+    Tcl_ResetResult(interp);
+    Tcl_DecrRefCount(objv[2]);
+    Tcl_DecrRefCount(argsObj);
+    Py_XDECREF(pProcArgs);
+    Py_XDECREF(pDefaults);
+    return ret;
 }
 
 //
-// tohil.getvar - from python get the contents of a variable
+// create a new python TclProc object from a tcl proc or command name.
+//
+//   if the caller already knows the proc's signature, say from a cache,
+//   it can pass proc_args and defaults, or is_proc=False for a C command,
+//   and we skip the introspection.
 //
 static PyObject *
-tohil_getvar(PyObject *self, PyObject *args, PyObject *kwargs)
+TohilTclProc_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
 {
-    static char *kwlist[] = {"var", "to", "default", NULL};
-    char *var = NULL;
-    PyTypeObject *to = NULL;
-    PyObject *defaultPyObj = NULL;
-    Tcl_Obj *obj = NULL;
+    static char *kwlist[] = {"proc", "to", "is_proc", "proc_args", "defaults", NULL};
+    PyObject *pProc = NULL;
+    PyObject *toType = (PyObject *)&PyUnicode_Type;
+    PyObject *pIsProc = Py_None;
+    PyObject *pProcArgs = Py_None;
+    PyObject *pDefaults = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "U|O$OOO", kwlist, &pProc, &toType, &pIsProc, &pProcArgs, &pDefaults)) {
+        return NULL;
+    }
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$OO", kwlist, &var, &to, &defaultPyObj)) {
+    if (toType != Py_None && !PyType_Check(toType)) {
+        PyErr_SetString(PyExc_RuntimeError, "to type is not a valid python data type");
         return NULL;
     }
 
-    if (defaultPyObj == NULL) {
-        // a default wasn't specified, it's an error if the var or array
-        // element doesn't exist
-        obj = Tcl_GetVar2Ex(tcl_interp, var, NULL, (TCL_LEAVE_ERR_MSG));
+    TohilTclProc *self = (TohilTclProc *)type->tp_alloc(type, 0);
+    if (self == NULL) {
+        return NULL;
+    }
 
-        if (obj == NULL) {
-            PyErr_SetString(PyExc_NameError, Tcl_GetString(Tcl_GetObjResult(tcl_interp)));
-            return NULL;
-        }
+    // tp_alloc zeroes everything, so dealloc can cope with a partially built object
+    self->interp = tcl_interp;
+    self->vectorcall = TohilTclProc_vectorcall;
+    self->proc = pProc;
+    Py_INCREF(pProc);
+    self->procObj = pyObjToTcl(tcl_interp, pProc);
+    Tcl_IncrRefCount(self->procObj);
+    self->to = (toType == Py_None) ? NULL : (PyTypeObject *)toType;
+    Py_XINCREF(self->to);
+
+    self->functionName = TohilTclProc_function_name(self->procObj);
+    if (self->functionName == NULL) {
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    int ret;
+    if (pProcArgs != Py_None) {
+        TohilTclProc_attach(self);
+        ret = TohilTclProc_set_signature(self, pProcArgs, pDefaults);
+    } else if (pIsProc != Py_None && !PyObject_IsTrue(pIsProc)) {
+        TohilTclProc_attach(self);
+        ret = 0;
     } else {
-        // a default was specified, it's not an error if the var or array
-        // element doesn't exist, we simply return the default value
-        obj = Tcl_GetVar2Ex(tcl_interp, var, NULL, 0);
-        if (obj == NULL) {
-            // not there but they provided a default
-            if (to == NULL) {
-                // they didn't provide a to= conversion,
-                // give them their default as is
-                Py_INCREF(defaultPyObj);
-                return defaultPyObj;
-            } else {
-                // they provided a to= conversion, run
-                // their python through that and return it.
-                obj = pyObjToTcl(tcl_interp, defaultPyObj);
-            }
-        }
+        ret = TohilTclProc_introspect(self);
     }
 
-    // the var or array element exists in tcl, return the value to python,
-    // possibly to a specific datatype
-    return tohil_python_return(tcl_interp, TCL_OK, to, obj);
+    if (ret < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
 }
 
 //
-// tohil.exists - from python see if a variable or array element exists in tcl
+// TohilTclProc_forget - throw away what we learned from introspection
+//   and take our trace off the command, if it's still there
 //
-static PyObject *
-tohil_exists(PyObject *self, PyObject *args, PyObject *kwargs)
+static void
+TohilTclProc_forget(TohilTclProc *self)
 {
-    static char *kwlist[] = {"var", NULL};
-    char *var = NULL;
-
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$", kwlist, &var))
-        return NULL;
-
-    Tcl_Obj *obj = Tcl_GetVar2Ex(tcl_interp, var, NULL, 0);
-
-    PyObject *p = (obj == NULL ? Py_False : Py_True);
-    Py_INCREF(p);
-    return p;
+    if (self->token != NULL) {
+        Tcl_Obj *fullNameObj = Tcl_NewObj();
+        Tcl_IncrRefCount(fullNameObj);
+        Tcl_GetCommandFullName(self->interp, self->token, fullNameObj);
+        Tcl_UntraceCommand(self->interp, Tcl_GetString(fullNameObj), TOHIL_COMMAND_TRACE_FLAGS, TohilTclProc_Trace, self);
+        Tcl_DecrRefCount(fullNameObj);
+        self->token = NULL;
+    }
+
+    if (self->defaultObjs != NULL) {
+        for (int i = 0; i < self->nSlots; i++) {
+            if (self->defaultObjs[i] != NULL) {
+                Tcl_DecrRefCount(self->defaultObjs[i]);
+            }
+        }
+        ckfree(self->defaultObjs);
+        self->defaultObjs = NULL;
+    }
+    Py_CLEAR(self->procArgs);
+    Py_CLEAR(self->defaults);
+    Py_CLEAR(self->slotMap);
+    self->nSlots = 0;
+    self->hasArgs = 0;
+    self->isProc = 0;
 }
 
 //
-// tohil.setvar - set a variable or array element in tcl from python
+// command trace proc - the command was renamed or deleted, so what we
+//   know about whatever has our proc name is no longer to be trusted
 //
-static PyObject *
-tohil_setvar(PyObject *self, PyObject *args, PyObject *kwargs)
+static void
+TohilTclProc_Trace(ClientData clientData, Tcl_Interp *interp, const char *oldName, const char *newName, int flags)
 {
-    static char *kwlist[] = {"var", "value", NULL};
-    char *var = NULL;
-    PyObject *pyValue = NULL;
-
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "sO", kwlist, &var, &pyValue))
-        return NULL;
+    TohilTclProc *self = (TohilTclProc *)clientData;
 
-    Tcl_Obj *tclValue = pyObjToTcl(tcl_interp, pyValue);
-
-    Tcl_Obj *obj = Tcl_SetVar2Ex(tcl_interp, var, NULL, tclValue, (TCL_LEAVE_ERR_MSG));
+    if (flags & TCL_TRACE_DESTROYED || newName == NULL || *newName == '\0') {
+        // tcl removes the trace itself once the command is deleted
+        self->token = NULL;
+    }
+    self->stale = 1;
+}
 
-    if (obj == NULL) {
-        char *errMsg = Tcl_GetString(Tcl_GetObjResult(tcl_interp));
-        PyErr_SetString(PyExc_RuntimeError, errMsg);
-        return NULL;
+static void
+TohilTclProc_dealloc(TohilTclProc *self)
+{
+    TohilTclProc_forget(self);
+    if (self->procObj != NULL) {
+        Tcl_DecrRefCount(self->procObj);
     }
-    Py_RETURN_NONE;
+    Py_XDECREF(self->proc);
+    Py_XDECREF(self->functionName);
+    Py_XDECREF(self->to);
+    Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
 //
-// tohil.incr - incr a variable or array element in tcl from python
+// call a TclProc.  bind the python positional and keyword arguments to
+//   the proc's parameters, fill in defaults, and invoke the proc.
+//
+//   keyword arguments are bound first, then positional arguments fill
+//   the remaining parameters in order, with any left over going to a
+//   trailing "args" parameter.  to= overrides the TclProc's to type.
 //
 static PyObject *
-tohil_incr(PyObject *self, PyObject *args, PyObject *kwargs)
+TohilTclProc_vectorcall(PyObject *pSelf, PyObject *const *args, size_t nargsf, PyObject *kwnames)
 {
-    static char *kwlist[] = {"var", "incr", NULL};
-    char *var = NULL;
-    long longValue = 0;
-    long increment = 1;
-
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|l", kwlist, &var, &increment))
-        return NULL;
+    TohilTclProc *self = (TohilTclProc *)pSelf;
+    PyTypeObject *to = self->to;
+    Py_ssize_t nargs = TOHIL_NARGS(nargsf);
+    Py_ssize_t nkw = 0;
+    Py_ssize_t toIndex = -1;
+    Py_ssize_t i;
+
+    // find to= among the keyword arguments
+    if (kwnames != NULL) {
+        nkw = PyTuple_GET_SIZE(kwnames);
+        for (i = 0; i < PyTuple_GET_SIZE(kwnames); i++) {
+            if (PyUnicode_CompareWithASCIIString(PyTuple_GET_ITEM(kwnames, i), "to") == 0) {
+                to = (PyTypeObject *)args[nargs + i];
+                toIndex = i;
+                nkw--;
+                break;
+            }
+        }
+    }
 
-    Tcl_Obj *obj = Tcl_GetVar2Ex(tcl_interp, var, NULL, 0);
-    if (obj == NULL) {
-        longValue = increment;
-        obj = Tcl_NewLongObj(longValue);
-        if (Tcl_SetVar2Ex(tcl_interp, var, NULL, obj, (TCL_LEAVE_ERR_MSG)) == NULL) {
-            goto type_error;
+    // the command's been renamed, deleted or redefined, have another look at it
+    if (self->stale) {
+        TohilTclProc_forget(self);
+        if (TohilTclProc_introspect(self) < 0) {
+            self->stale = 1;
+            return NULL;
         }
-    } else {
-        if (Tcl_GetLongFromObj(tcl_interp, obj, &longValue) == TCL_ERROR) {
-        type_error:
-            PyErr_SetString(PyExc_TypeError, Tcl_GetString(Tcl_GetObjResult(tcl_interp)));
+    }
+
+    if (!self->isProc) {
+        if (nkw > 0) {
+            PyErr_Format(PyExc_TypeError, "can't specify named parameters to a tcl function that isn't a proc: '%U'", self->proc);
             return NULL;
         }
+        return tohil_call_objv(1, &self->procObj, args, nargs, to);
+    }
 
-        longValue += increment;
+    if (!self->hasArgs && nargs + nkw > self->nSlots) {
+        PyErr_Format(PyExc_TypeError, "too many arguments specified to be passed to tcl proc '%U'", self->proc);
+        return NULL;
+    }
 
-        if (Tcl_IsShared(obj)) {
-            Tcl_DecrRefCount(obj);
-            obj = Tcl_DuplicateObj(obj);
-            Tcl_SetLongObj(obj, longValue);
-            if (Tcl_SetVar2Ex(tcl_interp, var, NULL, obj, (TCL_LEAVE_ERR_MSG)) == NULL) {
-                goto type_error;
+    PyObject *staticBound[TOHIL_STATIC_OBJV];
+    PyObject **bound = staticBound;
+    Tcl_Obj *staticObjv[TOHIL_STATIC_OBJV];
+    Tcl_Obj **objv = staticObjv;
+    PyObject *argsKeyword = NULL;
+    PyObject *argsFast = NULL;
+    PyObject *const *extrav = NULL;
+    Py_ssize_t nExtra = 0;
+    PyObject *pRet = NULL;
+
+    if (self->nSlots > TOHIL_STATIC_OBJV) {
+        bound = (PyObject **)ckalloc(sizeof(PyObject *) * self->nSlots);
+    }
+    for (i = 0; i < self->nSlots; i++) {
+        bound[i] = NULL;
+    }
+
+    // bind the keyword arguments into their slots
+    if (nkw > 0) {
+        for (Py_ssize_t k = 0; k < PyTuple_GET_SIZE(kwnames); k++) {
+            if (k == toIndex) {
+                continue;
             }
-        } else {
-            Tcl_SetLongObj(obj, longValue);
+            PyObject *key = PyTuple_GET_ITEM(kwnames, k);
+            PyObject *value = args[nargs + k];
+            PyObject *pSlot = PyDict_GetItemWithError(self->slotMap, key);
+            if (pSlot != NULL) {
+                bound[PyLong_AS_LONG(pSlot)] = value;
+                continue;
+            }
+            if (PyErr_Occurred()) {
+                goto done;
+            }
+            if (self->hasArgs && PyUnicode_CompareWithASCIIString(key, "args") == 0) {
+                argsKeyword = value;
+                continue;
+            }
+            PyErr_Format(PyExc_TypeError, "named parameter '%S' is not a valid argument for proc '%U'", key, self->proc);
+            goto done;
         }
     }
-    return PyLong_FromLong(longValue);
+
+    // positional arguments fill the remaining slots in order
+    Py_ssize_t pos = 0;
+    for (i = 0; i < self->nSlots && pos < nargs; i++) {
+        if (bound[i] == NULL) {
+            bound[i] = args[pos++];
+        }
+    }
+
+    // leftover positional arguments go to args, which must exist
+    // or we'd have complained about too many arguments above
+    if (pos < nargs) {
+        if (argsKeyword != NULL) {
+            PyErr_SetString(PyExc_TypeError, "parameter 'args' specified multiple times -- can only specify it once");
+            goto done;
+        }
+        extrav = &args[pos];
+        nExtra = nargs - pos;
+    } else if (argsKeyword != NULL) {
+        argsFast = PySequence_Fast(argsKeyword, "named parameter 'args' must be a sequence");
+        if (argsFast == NULL) {
+            goto done;
+        }
+        extrav = PySequence_Fast_ITEMS(argsFast);
+        nExtra = PySequence_Fast_GET_SIZE(argsFast);
+    }
+
+    // make sure we've got something for each of the proc's parameters
+    for (i = 0; i < self->nSlots; i++) {
+        if (bound[i] == NULL && self->defaultObjs[i] == NULL) {
+            PyErr_Format(PyExc_TypeError, "required arg '%U' missing", PyList_GET_ITEM(self->procArgs, i));
+            goto done;
+        }
+    }
+
+    // assemble the objv in the order the proc wants and invoke it
+    Py_ssize_t objc = 1 + self->nSlots + nExtra;
+    if (objc > TOHIL_STATIC_OBJV) {
+        objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
+    }
+    objv[0] = self->procObj;
+    Tcl_IncrRefCount(objv[0]);
+    for (i = 0; i < self->nSlots; i++) {
+        objv[1 + i] = (bound[i] != NULL) ? pyObjToTcl(self->interp, bound[i]) : self->defaultObjs[i];
+        Tcl_IncrRefCount(objv[1 + i]);
+    }
+    for (i = 0; i < nExtra; i++) {
+        objv[1 + self->nSlots + i] = pyObjToTcl(self->interp, extrav[i]);
+        Tcl_IncrRefCount(objv[1 + self->nSlots + i]);
+    }
+
+    pRet = tohil_evalobjv(objc, objv, to);
+
+done:
+    Py_XDECREF(argsFast);
+    if (objv != staticObjv) {
+        ckfree(objv);
+    }
+    if (bound != staticBound) {
+        ckfree(bound);
+    }
+    return pRet;
 }
 
-// tohil.unset - from python unset a variable or array element in the tcl
-//   interpreter.  it is not an error if the variable or element doesn't
-//   exist.  if passed the name of an array with no subscripted element,
-//   the entire array is deleted
+#ifndef TOHIL_VECTORCALL
 static PyObject *
-tohil_unset(PyObject *self, PyObject *args, PyObject *kwargs)
+TohilTclProc_call(PyObject *self, PyObject *args, PyObject *kwargs)
 {
-    static char *kwlist[] = {"var", NULL};
-    char *var = NULL;
-
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$", kwlist, &var))
-        return NULL;
+    return tohil_tp_call(TohilTclProc_vectorcall, self, args, kwargs);
+}
+#endif
 
-    Tcl_UnsetVar(tcl_interp, var, 0);
-    Py_RETURN_NONE;
+static PyObject *
+TohilTclProc_repr(TohilTclProc *self)
+{
+    return PyUnicode_FromFormat("<class 'TclProc' '%U', args '%R'>", self->proc, self->procArgs != NULL ? self->procArgs : Py_None);
 }
 
 //
-// tohil.subst - perform tcl "subst" substitution on the passed string,
-// evaluating square-bracketed stuff and expanding $-prefaced variables,
-// without evaluating the ultimate result, like eval would
+// TclProc attribute getters.  the object attributes are fixed once the
+//   TclProc is created, and the proc-only ones are None for C commands
 //
 static PyObject *
-tohil_subst(PyObject *self, PyObject *args, PyObject *kwargs)
+TohilTclProc_attribute(PyObject *attribute)
 {
-    static char *kwlist[] = {"string", "to", NULL};
-    char *string = NULL;
-    PyTypeObject *to = NULL;
-
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$O", kwlist, &string, &to)) {
-        return NULL;
-    }
-    Tcl_Obj *obj = Tcl_SubstObj(tcl_interp, Tcl_NewStringObj(string, -1), TCL_SUBST_ALL);
-    if (obj == NULL) {
-        char *errMsg = Tcl_GetString(Tcl_GetObjResult(tcl_interp));
-        PyErr_SetString(PyExc_RuntimeError, errMsg);
-        return NULL;
+    if (attribute == NULL) {
+        Py_RETURN_NONE;
     }
+    Py_INCREF(attribute);
+    return attribute;
+}
 
-    return tohil_python_return(tcl_interp, TCL_OK, to, obj);
+static PyObject *
+TohilTclProc_proc(TohilTclProc *self, void *closure)
+{
+    return TohilTclProc_attribute(self->proc);
 }
 
-//
-// tohil.call function for python that's like the tohil::call in tcl, something
-// that lets you explicitly specify a tcl command and its arguments and lets
-// you avoid passing everything through eval.  here it is.
-//
 static PyObject *
-tohil_call(PyObject *self, PyObject *args, PyObject *kwargs)
+TohilTclProc_function_name_get(TohilTclProc *self, void *closure)
 {
-    Py_ssize_t objc = PyTuple_GET_SIZE(args);
-    int i;
-    PyTypeObject *to = NULL;
+    return TohilTclProc_attribute(self->functionName);
+}
 
-    //
-    // allocate an array of Tcl object pointers the same size
-    // as the number of arguments we received
-    Tcl_Obj **objv = (Tcl_Obj **)ckalloc(sizeof(Tcl_Obj *) * objc);
+static PyObject *
+TohilTclProc_proc_args(TohilTclProc *self, void *closure)
+{
+    return TohilTclProc_attribute(self->procArgs);
+}
 
-    // PyObject_Print(kwargs, stdout, 0);
+static PyObject *
+TohilTclProc_defaults(TohilTclProc *self, void *closure)
+{
+    return TohilTclProc_attribute(self->defaults);
+}
 
-    // we need to process kwargs to get the to
-    if (kwargs != NULL) {
-        to = (PyTypeObject *)PyDict_GetItemString(kwargs, "to");
-    }
+static PyObject *
+TohilTclProc_is_proc(TohilTclProc *self, void *closure)
+{
+    return PyBool_FromLong(self->isProc);
+}
 
-    // for each argument convert the python object to a tcl object
-    // and store it in the tcl object vector
-    for (i = 0; i < objc; i++) {
-        objv[i] = pyObjToTcl(tcl_interp, PyTuple_GET_ITEM(args, i));
-        Tcl_IncrRefCount(objv[i]);
+//
+// TclProc.proc_to_function - static method to get the python function
+//   name a TclProc for a tcl proc name would have, without making one
+//
+static PyObject *
+TohilTclProc_proc_to_function(PyObject *unused, PyObject *pProc)
+{
+    if (!PyUnicode_Check(pProc)) {
+        PyErr_SetString(PyExc_TypeError, "proc name must be a str");
+        return NULL;
     }
+    Tcl_Obj *procObj = pyObjToTcl(tcl_interp, pProc);
+    Tcl_IncrRefCount(procObj);
+    PyObject *pFunction = TohilTclProc_function_name(procObj);
+    Tcl_DecrRefCount(procObj);
+    return pFunction;
+}
 
-    // invoke tcl using the objv array we just constructed
-    int tcl_result = Tcl_EvalObjv(tcl_interp, objc, objv, 0);
+static PyMethodDef TohilTclProc_methods[] = {
+    {"proc_to_function", (PyCFunction)TohilTclProc_proc_to_function, METH_O | METH_STATIC,
+     "convert a tcl proc name to a python function name"},
+    {NULL} // sentinel
+};
 
-    // cleanup and free the objv
-    for (i = 0; i < objc; i++) {
-        Tcl_DecrRefCount(objv[i]);
-    }
-    ckfree(objv);
+static PyGetSetDef TohilTclProc_getsetters[] = {
+    {"to_type", (getter)TohilTclObj_getto, (setter)TohilTclObj_setto, "python type to default returns to", NULL},
+    {"proc", (getter)TohilTclProc_proc, NULL, "name of the tcl proc or command", NULL},
+    {"function_name", (getter)TohilTclProc_function_name_get, NULL, "python-friendly function name for the proc", NULL},
+    {"proc_args", (getter)TohilTclProc_proc_args, NULL, "list of the proc's parameter names, None if not a proc", NULL},
+    {"defaults", (getter)TohilTclProc_defaults, NULL, "dict of the proc's parameters that have defaults, None if not a proc", NULL},
+    {"is_proc", (getter)TohilTclProc_is_proc, NULL, "true if the target is a tcl proc rather than a C command", NULL},
+    {NULL}};
 
-    return tohil_python_return(tcl_interp, tcl_result, to, Tcl_GetObjResult(tcl_interp));
-}
+static PyTypeObject TohilTclProcType = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "tohil.TclProc",
+    .tp_doc = "Tcl proc or command callable from python",
+    .tp_basicsize = sizeof(TohilTclProc),
+    .tp_itemsize = 0,
+#ifdef TOHIL_VECTORCALL
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_VECTORCALL,
+    .tp_vectorcall_offset = offsetof(TohilTclProc, vectorcall),
+    .tp_call = PyVectorcall_Call,
+#else
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_call = TohilTclProc_call,
+#endif
+    .tp_new = TohilTclProc_new,
+    .tp_dealloc = (destructor)TohilTclProc_dealloc,
+    .tp_repr = (reprfunc)TohilTclProc_repr,
+    .tp_methods = TohilTclProc_methods,
+    .tp_getset = TohilTclProc_getsetters,
+};
+
+//
+//
+// end of TclProc python datatype
+//
+//
 
 //
 // python C extension structure defining functions
@@ -2764,17 +7618,37 @@ tohil_call(PyObject *self, PyObject *args, PyObject *kwargs)
 // these are the tohil.* ones like tohil.eval, tohil.call, etc
 //
 static PyMethodDef TohilMethods[] = {
-    {"eval", (PyCFunction)tohil_eval, METH_VARARGS | METH_KEYWORDS, "Evaluate tcl code"},
-    {"getvar", (PyCFunction)tohil_getvar, METH_VARARGS | METH_KEYWORDS, "get vars and array elements from the tcl interpreter"},
-    {"setvar", (PyCFunction)tohil_setvar, METH_VARARGS | METH_KEYWORDS, "set vars and array elements in the tcl interpreter"},
-    {"exists", (PyCFunction)tohil_exists, METH_VARARGS | METH_KEYWORDS, "check whether vars and array elements exist in the tcl interpreter"},
-    {"unset", (PyCFunction)tohil_unset, METH_VARARGS | METH_KEYWORDS, "unset variables, array elements, or arrays from the tcl interpreter"},
-    {"incr", (PyCFunction)tohil_incr, METH_VARARGS | METH_KEYWORDS, "increment vars and array elements in the tcl interpreter"},
-    {"subst", (PyCFunction)tohil_subst, METH_VARARGS | METH_KEYWORDS, "perform Tcl command, variable and backslash substitutions on a string"},
-    {"expr", (PyCFunction)tohil_expr, METH_VARARGS | METH_KEYWORDS, "evaluate Tcl expression"},
-    {"convert", (PyCFunction)tohil_convert, METH_VARARGS | METH_KEYWORDS,
+    {"eval", (PyCFunction)(void (*)(void))tohil_eval, METH_FASTCALL | METH_KEYWORDS, "Evaluate tcl code"},
+    {"getvar", (PyCFunction)(void (*)(void))tohil_getvar, METH_FASTCALL | METH_KEYWORDS, "get vars and array elements from the tcl interpreter"},
+    {"setvar", (PyCFunction)(void (*)(void))tohil_setvar, METH_FASTCALL | METH_KEYWORDS, "set vars and array elements in the tcl interpreter"},
+    {"exists", (PyCFunction)(void (*)(void))tohil_exists, METH_FASTCALL | METH_KEYWORDS, "check whether vars and array elements exist in the tcl interpreter"},
+    {"unset", (PyCFunction)(void (*)(void))tohil_unset, METH_FASTCALL | METH_KEYWORDS, "unset variables, array elements, or arrays from the tcl interpreter"},
+    {"incr", (PyCFunction)(void (*)(void))tohil_incr, METH_FASTCALL | METH_KEYWORDS, "increment vars and array elements in the tcl interpreter"},
+    {"subst", (PyCFunction)(void (*)(void))tohil_subst, METH_FASTCALL | METH_KEYWORDS, "perform Tcl command, variable and backslash substitutions on a string"},
+    {"expr", (PyCFunction)(void (*)(void))tohil_expr, METH_FASTCALL | METH_KEYWORDS, "evaluate Tcl expression"},
+    {"columns", (PyCFunction)(void (*)(void))tohil_columns, METH_FASTCALL | METH_KEYWORDS,
+     "return the fields of a tcl list of dicts or lists as a dict of python columns"},
+    {"from_columns", (PyCFunction)(void (*)(void))tohil_from_columns, METH_FASTCALL | METH_KEYWORDS,
+     "return a tclobj list of dicts or lists made from a dict of python columns"},
+    {"convert", (PyCFunction)(void (*)(void))tohil_convert, METH_FASTCALL | METH_KEYWORDS,
      "convert python to tcl object then to whatever to= says or string and return"},
-    {"call", (PyCFunction)tohil_call, METH_VARARGS | METH_KEYWORDS, "invoke a tcl command with arguments"},
+    {"pybuffer", (PyCFunction)tohil_pybuffer, METH_O, "return a tclobj holding the bytes of a python buffer without copying them"},
+    {"pyref", (PyCFunction)tohil_pyref, METH_O, "return a tclobj that carries a python object through tcl by reference"},
+    {"call", (PyCFunction)(void (*)(void))tohil_call, METH_FASTCALL | METH_KEYWORDS, "invoke a tcl command with arguments"},
+    {"register_converter", (PyCFunction)(void (*)(void))tohil_register_converter, METH_FASTCALL,
+     "register a to= conversion for a python type"},
+    {"cache_info", (PyCFunction)tohil_cache_info, METH_NOARGS, "hit, miss and size statistics for the eval, expr and subst caches"},
+    {"cache_clear", (PyCFunction)tohil_cache_clear, METH_NOARGS, "empty the eval, expr and subst caches"},
+    {"cache_size", (PyCFunction)tohil_cache_size, METH_O,
+     "set the maximum number of entries in the eval, expr and subst caches, 0 disables them"},
+    {"churn_enable", (PyCFunction)tohil_churn_enable, METH_O, "turn tcl object representation churn diagnostics on or off"},
+    {"churn_stats", (PyCFunction)tohil_churn_stats, METH_NOARGS, "representation churn counted for each tohil operation"},
+    {"churn_clear", (PyCFunction)tohil_churn_clear, METH_NOARGS, "forget representation churn counted so far"},
+    {"pystr_cache", (PyCFunction)tohil_pystr_cache, METH_O, "turn on or off keeping python strs made from tcl strings in the tcl objects"},
+    {"intern_cache_info", (PyCFunction)tohil_intern_cache_info, METH_NOARGS, "hit, miss and size statistics and settings of the string intern cache"},
+    {"intern_cache_clear", (PyCFunction)tohil_intern_cache_clear, METH_NOARGS, "empty the string intern cache"},
+    {"intern_cache_config", (PyCFunction)(void (*)(void))tohil_intern_cache_config, METH_FASTCALL | METH_KEYWORDS,
+     "set the number of entries and the longest string in the string intern cache, size 0 turns it off"},
     {NULL, NULL, 0, NULL} /* Sentinel */
 };
 
@@ -2800,6 +7674,11 @@ Tohil_Init(Tcl_Interp *interp)
     if (Tcl_InitStubs(interp, "8.6", 0) == NULL)
         return TCL_ERROR;
 
+#ifdef USE_TCL_STUBS
+    if (Tcl_TomMath_InitStubs(interp, "8.6") == NULL)
+        return TCL_ERROR;
+#endif
+
     if (Tcl_PkgRequire(interp, "Tcl", "8.6", 0) == NULL)
         return TCL_ERROR;
 
@@ -2960,11 +7839,33 @@ PyInit__tohil(void)
     }
     tcl_interp = interp;
 
+    tclListType = Tcl_GetObjType("list");
+    tclDictType = Tcl_GetObjType("dict");
+    tclIntType = Tcl_GetObjType("int");
+    tclWideIntType = Tcl_GetObjType("wideInt");
+    tclDoubleType = Tcl_GetObjType("double");
+    tclByteArrayType = Tcl_GetObjType("bytearray");
+
+    // the bignum type isn't registered, so make one to find out what it is
+    Tcl_Obj *bignumObj = NULL;
+    Tcl_Obj *bignumExprObj = Tcl_NewStringObj("1 << 70", -1);
+    Tcl_IncrRefCount(bignumExprObj);
+    if (Tcl_ExprObj(interp, bignumExprObj, &bignumObj) == TCL_OK) {
+        tclBignumType = bignumObj->typePtr;
+        Tcl_DecrRefCount(bignumObj);
+    }
+    Tcl_DecrRefCount(bignumExprObj);
+
     // turn up the tclobj python type
     if (PyType_Ready(&TohilTclObjType) < 0) {
         return NULL;
     }
 
+    // turn up the tclobj iterator type
+    if (PyType_Ready(&PyTohil_TclObj_IterType) < 0) {
+        return NULL;
+    }
+
     // turn up the tclobj td iterator type
     if (PyType_Ready(&PyTohil_TD_IterType) < 0) {
         return NULL;
@@ -2975,6 +7876,27 @@ PyInit__tohil(void)
         return NULL;
     }
 
+    // turn up the Script python type
+    if (PyType_Ready(&TohilScriptType) < 0) {
+        return NULL;
+    }
+
+    if (PyType_Ready(&TohilCommandType) < 0) {
+        return NULL;
+    }
+
+    if (PyType_Ready(&TohilTclProcType) < 0) {
+        return NULL;
+    }
+
+    if (PyType_Ready(&TohilAutoType) < 0) {
+        return NULL;
+    }
+
+    if (tohil_init_converters() < 0) {
+        return NULL;
+    }
+
     // create the python module
     PyObject *m = PyModule_Create(&TohilModule);
     if (m == NULL) {
@@ -2997,16 +7919,6 @@ PyInit__tohil(void)
         return NULL;
     }
 
-    // find the TclObjIterator class and keep a reference to it
-    tohilTclObjIterator = PyObject_GetAttrString(pTohilMod, "TclObjIterator");
-    if (tohilTclObjIterator == NULL || !PyCallable_Check(tohilTclObjIterator)) {
-        Py_DECREF(pTohilMod);
-        Py_XDECREF(tohilTclObjIterator);
-        PyErr_SetString(PyExc_RuntimeError, "unable to find tohil.TclObjIterator class in python interpreter");
-        return NULL;
-    }
-    Py_INCREF(tohilTclObjIterator);
-
     // add our tclobj type to python
     Py_INCREF(&TohilTclObjType);
     if (PyModule_AddObject(m, "tclobj", (PyObject *)&TohilTclObjType) < 0) {
@@ -3023,6 +7935,35 @@ PyInit__tohil(void)
         return NULL;
     }
 
+    Py_INCREF(&TohilAutoType);
+    if (PyModule_AddObject(m, "auto", (PyObject *)&TohilAutoType) < 0) {
+        Py_DECREF(&TohilAutoType);
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    // add our Script type to python
+    Py_INCREF(&TohilScriptType);
+    if (PyModule_AddObject(m, "Script", (PyObject *)&TohilScriptType) < 0) {
+        Py_DECREF(&TohilScriptType);
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    Py_INCREF(&TohilCommandType);
+    if (PyModule_AddObject(m, "command", (PyObject *)&TohilCommandType) < 0) {
+        Py_DECREF(&TohilCommandType);
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    Py_INCREF(&TohilTclProcType);
+    if (PyModule_AddObject(m, "TclProc", (PyObject *)&TohilTclProcType) < 0) {
+        Py_DECREF(&TohilTclProcType);
+        Py_DECREF(m);
+        return NULL;
+    }
+
     // ..and stash a pointer to the tcl interpreter in a python
     // capsule so we can find it when we're doing python stuff
     // and need to talk to tcl
@@ -2,6 +2,10 @@
 
 from collections.abc import MutableMapping
 from io import StringIO
+import hashlib
+import marshal
+import mmap
+import os
 import sys
 import traceback
 import types
@@ -75,29 +79,6 @@ def interact():
     call("commandloop", "-prompt1", 'return  " % "', "-prompt2", 'return "> "')
 
 
-### tclobj iterator
-
-
-class TclObjIterator:
-    """tclobj iterator - one of these is returned by tclobj
-    iter function to iterate over a tclobj"""
-
-    def __init__(self, tclobj):
-        self.tclobj = tclobj
-        self.index = -1
-
-    def __iter__(self):
-        self.index = -1
-        return self
-
-    def __next__(self):
-        self.index += 1
-        if self.index >= self.tclobj.llength():
-            raise StopIteration
-
-        return self.tclobj.lindex(self.index)
-
-
 ### shadow dictionaries
 
 
@@ -245,17 +226,36 @@ def rivet():
 # which looks for it upon load
 
 from tohil._tohil import (
+    auto,
+    cache_clear,
+    cache_info,
+    cache_size,
     call,
+    churn_clear,
+    churn_enable,
+    churn_stats,
+    columns,
+    command,
     eval,
     exists,
     expr,
+    from_columns,
     getvar,
+    intern_cache_clear,
+    intern_cache_config,
+    intern_cache_info,
     interp,
+    pybuffer,
+    pyref,
+    pystr_cache,
+    register_converter,
     setvar,
     subst,
     unset,
     tclobj,
     tcldict,
+    Script,
+    TclProc,
     convert,
     incr,
     __version__,
@@ -272,6 +272,19 @@ proc safe_info_default {proc arg} {
     }
     return [list 0 ""]
 }
+
+proc safe_info_signature {proc} {
+    if {[catch {info args $proc} args]} {
+        return ""
+    }
+    set defaults [list]
+    foreach arg $args {
+        if {[info default $proc $arg var] == 1} {
+            lappend defaults $arg $var
+        }
+    }
+    return [list $args $defaults [info body $proc]]
+}
 """
 
 _tohil.eval(tcl_init)
@@ -318,208 +331,156 @@ def doublecolon_tail(string):
     return string
 
 
-class TclProc:
-    """instantiate with a tcl proc name as the argument.  the proc can be
-    in any namespace but the name should be fully qualified.  although
-    maybe not, not sure.
+###
+### persistent proc signature cache
+###
 
-    the init routine determines if the argument is a proc or a tcl
-    function written in C.  if it's a proc, it uses tcl's introspection
-    to obtain the proc's arguments and default parameters, if any.
+# bump when the layout of the cache file changes
+SIGNATURE_CACHE_FORMAT = 1
 
-    we define the __call__ method to check whether the tcl target is a proc
-    or C function and then call either our trampoline function or
-    passthrough_trampoline function, below.
-    """
 
-    def __init__(self, proc, to=str):
-        self.proc = proc
-        self.function_name = self._proc_to_function(proc)
+def signature_hash(proc):
+    """hash of a proc's arguments, defaults and body, or None if it isn't a proc"""
+    signature = call("safe_info_signature", proc, to=str)
+    if signature == "":
+        return None
+    return hashlib.blake2b(signature.encode(), digest_size=16).digest()
 
-        try:
-            self.proc_args = info_args(proc)
-            self.is_proc = True
-        except TclError:
-            # print(f"info args failed for proc '{proc}'")
-            self.is_proc = False
 
-        self.to_type = to
+def packages_key():
+    """the tohil and tcl versions and the names and versions of all
+    loaded tcl packages, which a signature cache file is only good for"""
+    packages = list()
+    for package in sorted(call("package", "names", to=list)):
+        version = call("package", "provide", package, to=str)
+        if version != "":
+            packages.append((package, version))
+    return (__version__, call("info", "patchlevel", to=str), tuple(packages))
 
-        if self.is_proc:
-            # self.body = info_body(proc)
-            self.defaults = dict()
-
-            for arg in self.proc_args:
-                has_default, default_value = info_default(proc, arg)
-                if int(has_default):
-                    self.defaults[arg] = default_value
-
-    def _proc_to_function(self, proc):
-        """conver ta tcl proc name to a python function name"""
-        function = doublecolon_tail(proc)
-        # python doesn't like dashes or colons in function names, so we map to underscores.
-        # "::" will map to "__" -- i think that's reasonable, at least for now.
-        # some other characters also appear in some tcl proc names out there, so we map
-        # them to other stuff.  tcl is too permissive, i feel like.
-        function = (
-            function.replace("-", "_")
-            .replace(":", "_")
-            .replace("?", "_question_mark")
-            .replace("+", "_plus_sign")
-            .replace("<", "_less_than")
-            .replace("@", "_at_sign")
-            .replace(">", "_greater_than")
-        )
-        return function
 
-    def __repr__(self):
-        """repr function"""
-        return f"<class 'TclProc' '{self.proc}', args '{repr(self.proc_args)}>"
-
-    def set_to(to):
-        self.to = to
-
-    def __call__(self, *args, **kwargs):
-        """this gets invoked when they call the object as if it is
-        a function.  we then return the results of our trampoline
-        or passthrough trampoline method, depending on if this instance
-        ingested a proc or C function"""
-        if self.is_proc:
-            return self.trampoline(args, kwargs)
-        else:
-            return self.passthrough_trampoline(args, kwargs)
+class SignatureCache:
+    """proc signatures, the arguments and defaults that TclProc gets from
+    tcl's introspection, persisted in a file so other processes, like
+    prefork workers, can create TclProcs without doing the introspection.
 
-    def passthrough_trampoline(self, args, kwargs):
-        """passthrough trampoline function is for calling C functions on the tcl
-        side where we don't know anything about what arguments it takes so we
-        treat everything as positional and pass through exactly what we get
+    a cache file is only used if the same tcl packages at the same versions
+    are loaded as when it was saved.  each proc's entry also has a hash of
+    the proc's arguments, defaults and body, and with verify on, that's
+    checked with one tcl call when the TclProc is created, so a proc that
+    has been redefined since the file was saved is introspected again.
+    with verify off, no tcl calls are made for cached procs at all.
+    """
 
-        but we still support the to= conversion... :-)"""
-        if "to" in kwargs:
-            to_type = kwargs["to"]
-            del kwargs["to"]
-        else:
-            to_type = self.to_type
+    def __init__(self, path, verify=True):
+        self.path = path
+        self.verify = verify
+        self.entries = dict()
+        self.hits = 0
+        self.misses = 0
+        self.load()
 
-        if len(kwargs) > 0:
-            raise TypeError(
-                f"can't specify named parameters to a tcl function that isn't a proc: '{self.proc}'"
+    def load(self):
+        """load the cache file, if it exists and matches the loaded packages"""
+        try:
+            with open(self.path, "rb") as f:
+                with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as mm:
+                    data = marshal.loads(mm)
+        except (OSError, ValueError, EOFError, TypeError):
+            # missing, empty or mangled, start over
+            return
+        if (
+            not isinstance(data, tuple)
+            or len(data) != 3
+            or data[0] != SIGNATURE_CACHE_FORMAT
+            or data[1] != packages_key()
+        ):
+            return
+        self.entries = data[2]
+
+    def save(self):
+        """write the cache file, atomically replacing any that's there"""
+        data = (SIGNATURE_CACHE_FORMAT, packages_key(), self.entries)
+        temp_path = f"{self.path}.{os.getpid()}.tmp"
+        with open(temp_path, "wb") as f:
+            marshal.dump(data, f)
+        os.replace(temp_path, self.path)
+
+    def tclproc(self, proc):
+        """create a TclProc for proc, from the cache if we can"""
+        entry = self.entries.get(proc)
+        if entry is not None:
+            proc_hash, proc_args, defaults = entry
+            if not self.verify or signature_hash(proc) == proc_hash:
+                self.hits += 1
+                if proc_hash is None:
+                    return TclProc(proc, is_proc=False)
+                return TclProc(proc, proc_args=proc_args, defaults=defaults)
+
+        self.misses += 1
+        tclproc = TclProc(proc)
+        if tclproc.is_proc:
+            self.entries[proc] = (
+                signature_hash(proc),
+                tclproc.proc_args,
+                tclproc.defaults,
             )
-        return call(self.proc, *args, to=to_type)
+        else:
+            self.entries[proc] = (None, None, None)
+        return tclproc
 
-    def trampoline(self, args, kwargs):
-        """trampoline function takes our proc probe data, positional parameters
-        and named parameters, figures out if everything's there that the proc
-        needs and calls the proc, or generates an exception for missing parameters,
-        too many parameters, unrecognized parameters, etc
+    def info(self):
+        """hit, miss and size statistics"""
+        return {
+            "path": self.path,
+            "hits": self.hits,
+            "misses": self.misses,
+            "size": len(self.entries),
+        }
 
-        if performance becomes an issue, this should be able to be converted to
-        C without great difficulty.  it's good in python while we figure it all out.
-        """
-        final = dict()
 
-        # print(f"trampoline invoked, self '{self}', args '{args}', kwargs '{kwargs}', defaults '{self.defaults}'")
+_signature_cache = None
 
-        if "to" in kwargs:
-            to_type = kwargs["to"]
-            del kwargs["to"]
-            # print(f"set aside to  of {to_type}")
-        else:
-            to_type = self.to_type
 
-        nargs = len(args)
-        if nargs + len(kwargs) > len(self.proc_args) and self.proc_args[-1] != "args":
-            raise TypeError(
-                f"too many arguments specified to be passed to tcl proc '{self.proc}'"
-            )
+def signature_cache(path=None, verify=True):
+    """use the proc signature cache file at path for creating the TclProcs
+    in TclNamespaces, loading it if it exists.  load your tcl packages
+    before you call this.  with path None, stop using the cache.  returns
+    the SignatureCache object."""
+    global _signature_cache
+    _signature_cache = None if path is None else SignatureCache(path, verify=verify)
+    return _signature_cache
+
+
+def save_signature_cache():
+    """save the proc signature cache, say in a prefork server's parent
+    after it has imported what its workers will use"""
+    if _signature_cache is None:
+        raise RuntimeError("no signature cache, call tohil.signature_cache(path) first")
+    _signature_cache.save()
 
-        # pump any named parameters into the "final" dict
-        # print("checking named parameters")
-        for arg_name, arg in kwargs.items():
-            if arg_name in final:
-                raise TypeError(
-                    f"parameter '{arg_name}' specified multiple times -- can only specify it once"
-                )
-            if arg_name not in self.proc_args:
-                raise TypeError(
-                    f"named parameter '{arg_name}' is not a valid arument for proc '{self.proc}'"
-                )
-            # print(f"trampoline filling in named parameter {arg_name}, '{repr(arg)}'")
-            final[arg_name] = arg
-
-        # pump the positional arguments into the "final" dict
-        # these args are positional from the python side; python already split out
-        # named parameters into kwargs before calling us.
-        #
-        # advance, matching the tcl arg names to the args tuple, but if an
-        # arg name is already in the final array due to having come from
-        # a named parameter, advance to the next argument, without advancing
-        # the args list.
-        # print("checking positional parameters")
-        pos = 0
-        # for arg_name, arg in zip(self.proc_args, args):
-        for arg_name in self.proc_args:
-            if pos >= nargs:
-                break
-            if arg_name != "args":
-                if arg_name not in final:
-                    # a position parameter has been fulfilled
-                    final[arg_name] = args[pos]
-                    # print(f"trampoline filling in position arg {arg_name}, '{repr(args[pos])}'")
-                else:
-                    # already have this from a named parameter, skip but
-                    # keep the current positional parameter for the next arg
-                    continue
-            else:
-                # this argument is the tcl-special "args",
-                # grab the remainder of the arg list into args and stop iterating.
-                # we'll make use of this to handle args correctly in our call to tcl.
-                final[arg_name] = args[pos:]
-                break
-            pos += 1
-
-        # pump any default values, if needed, by checking for the existence
-        # of the default values' var names in the final array.  if it isn't
-        # there, put it there.  if it is there, the default isn't needed.
-        # print("checking defaults")
-        for arg_name, def_value in self.defaults.items():
-            if arg_name not in final:
-                # print(f"trampoline filling in default value {arg_name}, '{def_value}'")
-                final[arg_name] = def_value
-
-        # make sure we've got something for each of the proc's argument - if anything are
-        # missing, it's an error.
-        for arg_name in self.proc_args:
-            # it's ok if args is missing
-            if not arg_name in final and arg_name != "args":
-                raise TypeError(f"required arg '{arg_name}' missing")
-
-        # assemble the final argument list in the correct order for the proc
-        final_arg_list = list()
-        for arg_name in self.proc_args:
-            if arg_name != "args":
-                final_arg_list.append(final[arg_name])
-            else:
-                # it's "args". if we have args (because we may not, if there
-                # weren't enough arguments specified to have there be one), extend
-                # the final_arg_list with them, i.e. add them flat instead of nested,
-                # the way tcl will expect the args args
-                if "args" in final:
-                    final_arg_list.extend(final[arg_name])
-
-        # ...and invoke the proc
-        # print(f"trampoline calling {self.proc} with final of '{repr(final_arg_list)}'")
-        return call(self.proc, *final_arg_list, to=to_type)
+
+def make_tclproc(proc):
+    """create a TclProc, using the signature cache if there is one"""
+    if _signature_cache is None:
+        return TclProc(proc)
+    return _signature_cache.tclproc(proc)
 
 
 class TclNamespace:
     """tcl namespace class -- one instance corresponds to a tcl namespace
 
-    it has the facility to import all the procs and C commands as TclProc
-    objects and keep track of them from the namespace
-
+    the procs and C commands in the namespace are available as TclProc
+    objects, and child namespaces as TclNamespace objects, as attributes.
 
+    nothing is imported up front.  the first time an attribute is accessed
+    that we don't have yet, __getattr__ takes a directory of the namespace's
+    commands and children, creates the one being asked for and stores it as
+    a regular attribute, so the next access doesn't come back through here.
+    if something isn't in the directory, it's retaken in case the proc or
+    namespace was created after we looked.
 
+    TclProcs notice when their proc is redefined and reintrospect it,
+    so the attributes don't go stale.
     """
 
     proc_excluder = (
@@ -539,7 +500,8 @@ class TclNamespace:
     )
 
     def __init__(self, namespace):
-        # print(f"{self} importing namespace '{namespace}'")
+        self.__tohil_namespace__ = namespace
+
         # be able to find TclProcs by proc name and function name, for convenience,
         # not actually used for anything yet
         self.__tohil_procs__ = dict()
@@ -547,35 +509,17 @@ class TclNamespace:
 
         # keep track of subordinate namespaces
         self.__tohil_namespaces__ = dict()
-        self.__tohil_import_namespace__(namespace)
-        # print(f"{self} done importing namespace '{namespace}'")
 
-    def __tohil_import_proc__(self, proc):
-        """create a callable TclProc object corresponding to "proc",
-        which can be a tcl proc or a C command"""
-        tclproc = TclProc(proc)
-        # print(f"setting name '{tclproc.function_name}'")
-        self.__tohil_procs__[proc] = tclproc
-        self.__tohil_functions__[tclproc.function_name] = tclproc
-
-        # create a new method in this tcl namespace comprising the
-        # tclproc function name and tclproc object we just created.
-        #
-        # when this namespace object.function_name() is invoked, it'll
-        # be called as a method of tclproc, i.e. self will be the first
-        # argument and will be the tclproc object ergo we can get to the
-        # trampoline and other stuff about the proc like its arguments,
-        # defaults, etc, because self is us.
-        self.__setattr__(
-            tclproc.function_name,
-            tclproc
-            # tclproc.function_name, types.MethodType(tclproc, tclproc)
-        )
-
-    def __tohil_import_procs__(self, pattern=None):
-        """import all the procs commands in one namespace"""
-        # print(f"    importing procs pattern '{pattern}', '{info_commands(pattern)}'")
-        for proc in info_commands(pattern):
+        # maps of python names to tcl procs and child namespaces,
+        # taken on the first attribute miss
+        self.__tohil_directory__ = None
+
+    def __tohil_take_directory__(self):
+        """map the python names of the namespace's procs and commands, and
+        of its child namespaces, to their tcl names"""
+        namespace = self.__tohil_namespace__
+        functions = dict()
+        for proc in info_commands(namespace + "::*"):
             # NB this excluder stuff is a little clumsy, but if it was
             # in the TclProc init routine then wouldn't that routine
             # have to raise an exception if it didn't want the thing created?
@@ -583,33 +527,65 @@ class TclNamespace:
                 continue
             if doublecolon_tail(proc) in TclNamespace.proc_excluder:
                 continue
-            try:
-                self.__tohil_import_proc__(proc)
-            except Exception as exception:
-                # except NameError:
-                # DES::Pad has a null byte for a default argument
-                if proc != "::DES::Pad":
-                    print(
-                        f"failed to import proc '{proc}', exception '{exception}', continuing...",
-                        file=sys.stderr,
-                    )
-        # print(f"    done importing procs pattern '{pattern}'")
-
-    def __tohil_import_namespace__(self, namespace="::"):
-        """import from a tcl namespace.  create a TclNamespace object
-        and import all the procs into it and return it
-
-        and import all the subordinate namespaces into them as well"""
-
-        self.__tohil_import_procs__(namespace + "::*")
+            functions[TclProc.proc_to_function(proc)] = proc
 
+        namespaces = dict()
         for child in namespace_children(namespace):
-            # print(f"  importing child namespace {child}")
-            new_namespace = TclNamespace(child)
+            namespaces[doublecolon_tail(child)] = child
+
+        self.__tohil_directory__ = (functions, namespaces)
+
+    def __tohil_resolve__(self, name):
+        """create the TclProc or TclNamespace for a python name from the
+        directory, or return None if the directory doesn't have it"""
+        functions, namespaces = self.__tohil_directory__
+
+        # child namespaces win over procs with the same name
+        if name in namespaces:
+            new_namespace = TclNamespace(namespaces[name])
+            self.__tohil_namespaces__[name] = new_namespace
+            return new_namespace
+
+        if name in functions:
+            proc = functions[name]
+            tclproc = make_tclproc(proc)
+            self.__tohil_procs__[proc] = tclproc
+            self.__tohil_functions__[name] = tclproc
+            return tclproc
+
+        return None
+
+    def __getattr__(self, name):
+        """find procs, commands and child namespaces the first time
+        they're asked for"""
+        # don't go to tcl for python's special names, or for our own
+        # before __init__ has run.  names like __helper can be procs.
+        if name.startswith("__") and name.endswith("__"):
+            raise AttributeError(name)
+
+        took_directory = False
+        if self.__tohil_directory__ is None:
+            self.__tohil_take_directory__()
+            took_directory = True
+
+        found = self.__tohil_resolve__(name)
+        if found is None and not took_directory:
+            self.__tohil_take_directory__()
+            found = self.__tohil_resolve__(name)
+
+        if found is None:
+            raise AttributeError(
+                f"tcl namespace '{self.__tohil_namespace__}' has no proc, command or child namespace '{name}'"
+            )
+
+        # store it so later lookups don't come through here
+        self.__setattr__(name, found)
+        return found
 
-            child_short = doublecolon_tail(child)
-            # print(f"  {self} storing child {child_short} namespace {new_namespace}")
-            self.__setattr__(child_short, new_namespace)
+    def __dir__(self):
+        self.__tohil_take_directory__()
+        functions, namespaces = self.__tohil_directory__
+        return sorted(set(super().__dir__()) | set(functions) | set(namespaces))
 
 
 def import_tcl():
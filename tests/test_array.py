@@ -0,0 +1,78 @@
+import array
+import mmap
+import unittest
+
+import tohil
+
+
+class TestArray(unittest.TestCase):
+    def test_array1(self):
+        """as_array makes an array.array from a tcl list of numbers"""
+        t = tohil.eval("list 1 2.5 -3", to=tohil.tclobj)
+        self.assertEqual(t.as_array("d"), array.array("d", [1, 2.5, -3]))
+        self.assertEqual(t._tcltype, "list")
+        t = tohil.tclobj("1 2 -3")
+        for typecode in "bhilq":
+            self.assertEqual(t.as_array(typecode), array.array(typecode, [1, 2, -3]))
+        self.assertEqual(tohil.tclobj("0 255").as_array("B"), array.array("B", [0, 255]))
+        self.assertEqual(tohil.tclobj("0.5").as_array("f"), array.array("f", [0.5]))
+        self.assertEqual(tohil.tclobj("").as_array("i"), array.array("i"))
+
+    def test_array2(self):
+        """as_array rejects what doesn't fit"""
+        with self.assertRaises(OverflowError):
+            tohil.tclobj("1 200").as_array("b")
+        with self.assertRaises(OverflowError):
+            tohil.tclobj("-1").as_array("I")
+        with self.assertRaises(TypeError):
+            tohil.tclobj("1 x").as_array("i")
+        with self.assertRaises(TypeError):
+            tohil.tclobj("1.5").as_array("i")
+        with self.assertRaises(ValueError):
+            tohil.tclobj("1").as_array("u")
+
+    def test_array3(self):
+        """from_buffer makes a tcl list of the numbers in a buffer"""
+        t = tohil.tclobj.from_buffer(array.array("d", [1.5, 2, -3]))
+        self.assertEqual(t._tcltype, "list")
+        self.assertEqual(list(t.as_array("d")), [1.5, 2, -3])
+        self.assertEqual(str(tohil.tclobj.from_buffer(array.array("Q", [2**64 - 1]))), "18446744073709551615")
+        self.assertEqual(str(tohil.tclobj.from_buffer(b"ab")), "97 98")
+        grid = memoryview(array.array("i", range(6))).cast("B").cast("i", [2, 3])
+        self.assertEqual(tohil.tclobj.from_buffer(grid).as_list(), ["0 1 2", "3 4 5"])
+        with self.assertRaises(ValueError):
+            tohil.tclobj.from_buffer(memoryview(b"ab").cast("c"))
+        with self.assertRaises(TypeError):
+            tohil.tclobj.from_buffer(3)
+
+    def test_array4(self):
+        """number buffers convert to tcl lists without going through python numbers"""
+        self.assertEqual(tohil.call("lindex", array.array("h", [5, -6]), 1, to=int), -6)
+        self.assertEqual(tohil.tclobj(array.array("d", [0.25]))._tcltype, "list")
+
+    def test_array5(self):
+        """unsigned 64-bit typecodes take values above the signed range"""
+        for typecode in "QL":
+            if array.array(typecode).itemsize != 8:
+                continue
+            values = array.array(typecode, [0, 2**63, 2**64 - 1])
+            self.assertEqual(tohil.tclobj.from_buffer(values).as_array(typecode), values)
+            self.assertEqual(tohil.tclobj("18446744073709551615").as_array(typecode), array.array(typecode, [2**64 - 1]))
+            with self.assertRaises(OverflowError):
+                tohil.tclobj("18446744073709551616").as_array(typecode)
+            with self.assertRaises(OverflowError):
+                tohil.tclobj("-1").as_array(typecode)
+
+    def test_array6(self):
+        """buffers too long for a tcl list raise OverflowError"""
+        # an anonymous mmap's pages aren't touched until they're read
+        with mmap.mmap(-1, 2**29 + 1) as m:
+            with memoryview(m).cast("b") as view:
+                with self.assertRaises(OverflowError):
+                    tohil.tclobj.from_buffer(view)
+                with self.assertRaises(OverflowError):
+                    tohil.tclobj(view)
+
+
+if __name__ == "__main__":
+    unittest.main()
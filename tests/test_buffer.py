@@ -0,0 +1,86 @@
+import hashlib
+import struct
+import unittest
+import zlib
+
+import tohil
+
+
+class TestBuffer(unittest.TestCase):
+    def test_buffer1(self):
+        """tcl byte arrays can be read through the buffer protocol"""
+        data = bytes(range(256)) * 100
+        t = tohil.tclobj(data)
+        m = memoryview(t)
+        self.assertTrue(m.readonly)
+        self.assertEqual(m.nbytes, len(data))
+        self.assertEqual(m.tobytes(), data)
+        self.assertEqual(hashlib.sha256(t).digest(), hashlib.sha256(data).digest())
+        self.assertEqual(zlib.crc32(t), zlib.crc32(data))
+        self.assertEqual(struct.unpack_from(">I", t, 1), (0x01020304,))
+        m.release()
+
+    def test_buffer2(self):
+        """the tclobj can't be converted or changed while views exist"""
+        t = tohil.eval("binary format a* [string repeat abc 100]", to=tohil.tclobj)
+        with memoryview(t) as m:
+            with self.assertRaises(BufferError):
+                t.llength()
+            with self.assertRaises(BufferError):
+                t.lappend("x")
+            with self.assertRaises(BufferError):
+                t.set("x")
+            self.assertEqual(t.as_byte_array(), bytearray(b"abc" * 100))
+            self.assertEqual(tohil.call("string", "length", t, to=int), 300)
+            self.assertEqual(tohil.call("llength", t, to=int), 1)
+            self.assertEqual(m[:3].tobytes(), b"abc")
+        self.assertEqual(t.llength(), 1)
+
+    def test_buffer3(self):
+        """the tcl object is pinned, and a shared one copied, while views exist"""
+        tohil.eval("set buffer3 [binary format a* xyz]")
+        t = tohil.getvar("buffer3", to=tohil.tclobj)
+        with memoryview(t) as m:
+            self.assertEqual(t._refcount, 2)
+            tohil.eval("lappend buffer3 more")
+            self.assertEqual(m.tobytes(), b"xyz")
+        self.assertEqual(t._refcount, 1)
+
+    def test_buffer4(self):
+        """only byte arrays and pure strings can be exported, read-only"""
+        with self.assertRaises(BufferError):
+            memoryview(tohil.tclobj([1, 2, 3]))
+        self.assertEqual(bytes(memoryview(tohil.tclobj("abc"))), b"abc")
+        with memoryview(tohil.tclobj(b"abc")) as m:
+            with self.assertRaises(TypeError):
+                m[0] = 1
+
+    def test_buffer5(self):
+        """a tclobj with views is appended to another as a copy"""
+        blob = tohil.tclobj(b"abcdef")
+        m = memoryview(blob)
+        t = tohil.tclobj([])
+        t.lappend_list(blob)
+        self.assertEqual(bytes(m[:6]), b"abcdef")
+        self.assertEqual(blob._tcltype, "bytearray")
+        self.assertEqual(t.as_list(), ["abcdef"])
+        m.release()
+
+    def test_buffer6(self):
+        """a string that python has cached a str for can still be exported"""
+        tohil.pystr_cache(True)
+        try:
+            t = tohil.tclobj("abc")
+            self.assertEqual(str(t), "abc")
+            self.assertEqual(t._tcltype, "pystr")
+            self.assertEqual(bytes(memoryview(t)), b"abc")
+            u = tohil.tclobj("xyz")
+            str(u)
+            self.assertEqual(u.as_byte_array(), bytearray(b"xyz"))
+            self.assertEqual(u._tcltype, "bytearray")
+        finally:
+            tohil.pystr_cache(False)
+
+
+if __name__ == "__main__":
+    unittest.main()
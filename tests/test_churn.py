@@ -0,0 +1,68 @@
+import sys
+import unittest
+
+import tohil
+
+
+class TestChurn(unittest.TestCase):
+    def setUp(self):
+        tohil.churn_clear()
+        tohil.churn_enable(True)
+
+    def tearDown(self):
+        tohil.churn_enable(False)
+        tohil.churn_clear()
+
+    def test_churn1(self):
+        """shimmering and copies of shared objects are counted by operation"""
+        x = tohil.eval("dict create a 1 b 2", to=tohil.tclobj)
+        tohil.setvar("churn1", x)
+        x.lappend("c")
+        stats = tohil.churn_stats()
+        lappend = stats["tclobj.lappend"]
+        self.assertEqual(lappend["calls"], 1)
+        self.assertEqual(lappend["dups"], 1)
+        self.assertEqual(lappend["dup_elements"], 2)
+        self.assertEqual(lappend["shimmers"], 1)
+        self.assertEqual(lappend["transitions"], {("dict", "list"): 1})
+        self.assertEqual(stats["to=tohil.tclobj"]["calls"], 1)
+
+    def test_churn2(self):
+        """string reps made by an operation are counted"""
+        x = tohil.tclobj([1, 2, 3])
+        str(x)
+        stats = tohil.churn_stats()["str(tclobj)"]
+        self.assertEqual(stats["string_reps"], 1)
+        self.assertEqual(stats["string_rep_bytes"], 5)
+        self.assertEqual(stats["shimmers"], 0)
+
+    def test_churn3(self):
+        """nothing is counted when diagnostics are off"""
+        tohil.churn_enable(False)
+        x = tohil.tclobj("1 2 3")
+        len(x)
+        self.assertEqual(tohil.churn_stats(), {})
+        tohil.churn_enable(True)
+        len(x)
+        self.assertEqual(tohil.churn_stats()["len(tclobj)"]["calls"], 1)
+        tohil.churn_clear()
+        self.assertEqual(tohil.churn_stats(), {})
+
+    def test_churn4(self):
+        """each operation's counts are broken down by the calling file and line"""
+        x = tohil.tclobj("a 1 b 2")
+        line = sys._getframe().f_lineno + 1
+        x.llength()
+        tohil.tclobj("1 2").llength()
+        stats = tohil.churn_stats()["tclobj.llength"]
+        self.assertEqual(stats["calls"], 2)
+        callers = stats["callers"]
+        self.assertEqual(len(callers), 2)
+        caller = callers[f"{__file__}:{line}"]
+        self.assertEqual(caller["calls"], 1)
+        self.assertEqual(caller["string_reps"], 0)
+        self.assertEqual(sum(c["calls"] for c in callers.values()), 2)
+
+
+if __name__ == "__main__":
+    unittest.main()
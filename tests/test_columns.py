@@ -0,0 +1,65 @@
+import array
+import unittest
+
+import tohil
+
+
+class TestColumns(unittest.TestCase):
+    def setUp(self):
+        self.rows = tohil.eval("list [dict create name a x 1 y 2.5] [dict create name b x 2 y 3.5]", to=tohil.tclobj)
+
+    def test_columns1(self):
+        """columns of a list of dicts, fields from the first row"""
+        self.assertEqual(tohil.columns(self.rows), {"name": ["a", "b"], "x": ["1", "2"], "y": ["2.5", "3.5"]})
+        self.assertEqual(tohil.columns(""), {})
+
+    def test_columns2(self):
+        """typed columns, as to= types and array typecodes"""
+        cols = tohil.columns(self.rows, fields=["x", "y", "name"], types=[int, "d", None])
+        self.assertEqual(cols, {"x": [1, 2], "y": array.array("d", [2.5, 3.5]), "name": ["a", "b"]})
+        self.assertEqual(tohil.columns(self.rows, fields=["x"], types=["q"])["x"], array.array("q", [1, 2]))
+
+    def test_columns3(self):
+        """columns of a list of lists, by position"""
+        cols = tohil.columns("{1 2} {3 4}", fields=[1, 0], types=[int, "i"])
+        self.assertEqual(cols, {1: [2, 4], 0: array.array("i", [1, 3])})
+
+    def test_columns4(self):
+        """missing fields and bad rows raise"""
+        with self.assertRaises(KeyError):
+            tohil.columns(self.rows, fields=["z"])
+        with self.assertRaises(IndexError):
+            tohil.columns("{1 2} {3}", fields=[1])
+        with self.assertRaises(TypeError):
+            tohil.columns("a {b c d}", fields=["b"])
+        with self.assertRaises(TypeError):
+            tohil.columns("{x a}", fields=["x"], types=["i"])
+        with self.assertRaises(ValueError):
+            tohil.columns(self.rows, fields=["x"], types=[int, int])
+
+    def test_from_columns1(self):
+        """a list of dicts from python columns"""
+        t = tohil.from_columns({"name": ["a", "b"], "x": array.array("q", [1, 2]), "y": [2.5, 3.5]})
+        self.assertEqual(str(t), "{name a x 1 y 2.5} {name b x 2 y 3.5}")
+        self.assertEqual(tohil.call("dict", "get", t[1], "x", to=int), 2)
+        self.assertEqual(tohil.columns(t, types=[str, "q", "d"])["y"], array.array("d", [2.5, 3.5]))
+        self.assertEqual(str(tohil.from_columns({})), "")
+
+    def test_from_columns2(self):
+        """a list of lists from python columns, and columns that don't line up"""
+        self.assertEqual(str(tohil.from_columns({"a": [1, 2], "b": (3, 4)}, to=list)), "{1 3} {2 4}")
+        with self.assertRaises(ValueError):
+            tohil.from_columns({"a": [1, 2], "b": [3]})
+        with self.assertRaises(ValueError):
+            tohil.from_columns({"a": [1]}, to=tuple)
+
+    def test_from_columns3(self):
+        """more rows or values than a tcl list holds raise OverflowError"""
+        with self.assertRaises(OverflowError):
+            tohil.from_columns({"a": range(2**30)})
+        with self.assertRaises(OverflowError):
+            tohil.from_columns({"a": range(2**28), "b": range(2**28), "c": range(2**28)})
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,52 @@
+import unittest
+
+import tohil
+
+
+class TestCommand(unittest.TestCase):
+    def test_command1(self):
+        """tohil.command calls a tcl command with unsubstituted arguments"""
+        tohil.eval("proc ::cmd_test1 {a b} {return [list $a $b]}")
+        f = tohil.command("cmd_test1")
+        self.assertEqual(f.name, "::cmd_test1")
+        self.assertEqual(f("[exit]", "$nope"), "{[exit]} {$nope}")
+        self.assertEqual(f(1, 2, to=list), ["1", "2"])
+        self.assertEqual(repr(f), "<tohil.command: '::cmd_test1'>")
+
+    def test_command2(self):
+        """tohil.command in a namespace and with to="""
+        tohil.eval("namespace eval ::cmd_ns {proc add {a b} {expr {$a + $b}}}")
+        add = tohil.command("::cmd_ns::add", to=int)
+        self.assertEqual(add(2, 3), 5)
+        self.assertEqual(add(2, 3, to=str), "5")
+        with self.assertRaises(TypeError):
+            add(a=2, b=3)
+        with self.assertRaises(tohil.TclError):
+            add(1)
+
+    def test_command3(self):
+        """tohil.command follows renames and redefinitions"""
+        tohil.eval("proc ::cmd_test3 {} {return one}")
+        f = tohil.command("::cmd_test3")
+        self.assertEqual(f(), "one")
+        tohil.eval("rename ::cmd_test3 ::cmd_test3_renamed")
+        self.assertEqual(f.name, "::cmd_test3_renamed")
+        self.assertEqual(f(), "one")
+        tohil.eval("proc ::cmd_test3_renamed {} {return two}")
+        self.assertEqual(f(), "two")
+        tohil.eval("rename ::cmd_test3_renamed {}")
+        self.assertFalse(f.exists)
+        with self.assertRaises(NameError):
+            f()
+        tohil.eval("proc ::cmd_test3_renamed {} {return three}")
+        self.assertTrue(f.exists)
+        self.assertEqual(f(), "three")
+
+    def test_command4(self):
+        """tohil.command of a nonexistent command"""
+        with self.assertRaises(NameError):
+            tohil.command("::no_such_command_here")
+
+
+if __name__ == "__main__":
+    unittest.main()
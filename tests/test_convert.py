@@ -58,6 +58,148 @@ class TestMethods(unittest.TestCase):
             repr(tohil.convert("1 2 3", to=tohil.tclobj)), "<tohil.tclobj: '1 2 3'>"
         )
 
+    def test_convert9(self):
+        """exercise tohil.register_converter with a python converter"""
+
+        class Point:
+            def __init__(self, x, y):
+                self.x, self.y = x, y
+
+        def to_point(t):
+            return Point(*t.as_list())
+
+        with self.assertRaises(RuntimeError):
+            tohil.convert("1 2", to=Point)
+        tohil.register_converter(Point, to_point)
+        try:
+            p = tohil.eval("list 3 4", to=Point)
+            self.assertIsInstance(p, Point)
+            self.assertEqual((p.x, p.y), ("3", "4"))
+            self.assertIsInstance(tohil.convert("5 6", to=Point), Point)
+        finally:
+            tohil.register_converter(Point, None)
+        with self.assertRaises(RuntimeError):
+            tohil.convert("1 2", to=Point)
+
+    def test_convert10(self):
+        """tohil.register_converter argument checking"""
+        with self.assertRaises(ValueError):
+            tohil.register_converter(int, lambda t: 0)
+        with self.assertRaises(TypeError):
+            tohil.register_converter("int", lambda t: 0)
+        with self.assertRaises(TypeError):
+            tohil.register_converter(complex, 5)
+        # removing a registration that isn't there is fine
+        tohil.register_converter(complex, None)
+
+    def test_convert11(self):
+        """exercise to=tohil.auto on typed tcl values"""
+        self.assertEqual(tohil.eval("expr {6 * 7}", to=tohil.auto), 42)
+        self.assertEqual(tohil.eval("expr {1 << 70}", to=tohil.auto), 1 << 70)
+        self.assertEqual(tohil.eval("expr {-(1 << 70)}", to=tohil.auto), -(1 << 70))
+        self.assertEqual(tohil.eval("expr {1.5}", to=tohil.auto), 1.5)
+        self.assertEqual(tohil.eval("binary format a3 abc", to=tohil.auto), b"abc")
+        self.assertEqual(
+            tohil.eval("list [expr 1] [list a [expr 2.5]]", to=tohil.auto), [1, ["a", 2.5]]
+        )
+        self.assertEqual(
+            tohil.eval("dict create a [expr 1] [list x y] [expr 2] b [dict create c d]", to=tohil.auto),
+            {"a": 1, "x y": 2, "b": {"c": "d"}},
+        )
+
+    def test_convert12(self):
+        """to=tohil.auto doesn't parse or shimmer untyped values"""
+        t = tohil.tclobj("12")
+        self.assertEqual(tohil.convert(t, to=tohil.auto), "12")
+        self.assertEqual(t._tcltype, None)
+        self.assertEqual(tohil.convert("1 2 3", to=tohil.auto), "1 2 3")
+        with self.assertRaises(TypeError):
+            tohil.auto()
+
+    def test_convert13(self):
+        """python ints and floats become tcl numbers, big ones too"""
+        for n in (0, -1, 2**63 - 1, -(2**63), 2**63, -(2**63) - 1, 3**150, -(7**99)):
+            t = tohil.tclobj(n)
+            self.assertIn(t._tcltype, ("int", "wideInt", "bignum"))
+            self.assertEqual(str(t), str(n))
+            self.assertEqual(t.as_int(), n)
+            self.assertEqual(tohil.convert(n, to=int), n)
+            self.assertEqual(tohil.expr(f"{n} * 3", to=int), n * 3)
+        t = tohil.tclobj(0.1)
+        self.assertEqual(t._tcltype, "double")
+        self.assertEqual(str(t), "0.1")
+        self.assertEqual(tohil.expr("1 << 80", to=int), 1 << 80)
+
+    def test_convert14(self):
+        """python containers and iterables become tcl lists and dicts"""
+        self.assertEqual(str(tohil.tclobj([1, (2, 3), [4, [5]]])), "1 {2 3} {4 5}")
+        self.assertEqual(
+            str(tohil.tclobj({"a": 1, "b": {"c": [1, (2, 3)]}})), "a 1 b {c {1 {2 3}}}"
+        )
+        self.assertEqual(sorted(tohil.tclobj({3, 1, 2}).as_list()), ["1", "2", "3"])
+        self.assertEqual(sorted(tohil.tclobj(frozenset("ab")).as_list()), ["a", "b"])
+        self.assertEqual(str(tohil.tclobj(i * i for i in range(5))), "0 1 4 9 16")
+        self.assertEqual(str(tohil.tclobj({"a": 1, "b": 2}.keys())), "a b")
+        self.assertEqual(str(tohil.tclobj(range(3))), "0 1 2")
+        self.assertEqual(str(tohil.tclobj([])), "")
+
+        # iterators that aren't generators aren't used up
+        it = iter([1, 2])
+        tohil.tclobj(it)
+        self.assertEqual(list(it), [1, 2])
+
+    def test_convert15(self):
+        """a list changing size while it's being converted"""
+
+        class Shrinker:
+            def __init__(self, l):
+                self.l = l
+
+            def __str__(self):
+                self.l.clear()
+                return "x"
+
+        l = [1, 2, 3]
+        l.insert(1, Shrinker(l))
+        self.assertEqual(str(tohil.tclobj(l)), "1 x")
+
+    def test_convert16(self):
+        """tcl strings of all sorts come back to python intact"""
+        for s in ("", "abc", "x" * 1000, "façade", "x" * 7 + "é", "日本語", "한국어", "a\x00b", "😀"):
+            tohil.setvar("s", s)
+            self.assertEqual(tohil.getvar("s"), s)
+            self.assertEqual(str(tohil.tclobj(s)), s)
+            self.assertEqual(tohil.eval("list $s $s", to=list), [s, s])
+            self.assertEqual(tohil.eval("list $s $s", to=tuple), (s, s))
+            self.assertEqual(tohil.eval("dict create $s $s", to=dict), {s: s})
+        self.assertEqual(tohil.eval("format %c 0"), "\x00")
+
+    def test_convert17(self):
+        """python strings arrive in tcl as the same characters"""
+        for s in ("abc", "façade", "日本語", "a\x00b", "\x00"):
+            tohil.setvar("s", s)
+            self.assertEqual(tohil.eval("string length $s", to=int), len(s))
+            self.assertEqual(
+                tohil.eval("scan [string index $s end] %c", to=int), ord(s[-1])
+            )
+            self.assertEqual(tohil.call("string", "length", s, to=int), len(s))
+
+    def test_convert18(self):
+        """an iterable's length hint only sizes the list, it isn't trusted"""
+
+        class Hinted:
+            def __init__(self, items):
+                self.items = items
+
+            def __iter__(self):
+                return iter(self.items)
+
+            def __length_hint__(self):
+                return 2**31 - 2
+
+        self.assertEqual(tohil.convert(Hinted([])), "")
+        self.assertEqual(tohil.convert(Hinted([1, 2, 3]), to=list), ["1", "2", "3"])
+
 
 if __name__ == "__main__":
     unittest.main()
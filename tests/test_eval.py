@@ -49,6 +49,49 @@ class TestEval(unittest.TestCase):
         with self.assertRaises(NameError):
             tohil.eval("list 1 2 3", to=no_such_type)
 
+    def test_eval8(self):
+        """tohil.eval, expr and subst reuse cached tcl objects"""
+        tohil.cache_clear()
+        for i in range(3):
+            self.assertEqual(tohil.eval("set cache_test [expr {6 * 7}]", to=int), 42)
+            self.assertEqual(tohil.expr("$cache_test + 1", to=int), 43)
+            self.assertEqual(tohil.subst("answer $cache_test"), "answer 42")
+        info = tohil.cache_info()
+        for which in ("eval", "expr", "subst"):
+            self.assertEqual(info[which]["misses"], 1)
+            self.assertEqual(info[which]["hits"], 2)
+            self.assertEqual(info[which]["size"], 1)
+
+        saved_size = info["maxsize"]
+        tohil.cache_size(0)
+        self.assertEqual(tohil.eval("set cache_test"), "42")
+        self.assertEqual(tohil.cache_info()["eval"]["size"], 0)
+        tohil.cache_size(saved_size)
+
+        with self.assertRaises(ValueError):
+            tohil.cache_size(-1)
+
+    def test_eval9(self):
+        """argument checking"""
+        self.assertEqual(tohil.eval(tcl_code="return 5", to=int), 5)
+        self.assertEqual(tohil.getvar("no_such_var", default=7), 7)
+        with self.assertRaises(TypeError):
+            tohil.eval()
+        with self.assertRaises(TypeError):
+            tohil.eval("return 5", int)
+        with self.assertRaises(TypeError):
+            tohil.eval("return 5", too=int)
+        with self.assertRaises(TypeError):
+            tohil.eval("return 5", tcl_code="return 6")
+        with self.assertRaises(TypeError):
+            tohil.eval(5)
+        with self.assertRaises(ValueError):
+            tohil.eval("return \0")
+        with self.assertRaises(TypeError):
+            tohil.call("set", "x", too=int)
+        with self.assertRaises(TypeError):
+            tohil.incr("x", 1.5)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,62 @@
+import unittest
+
+import tohil
+
+
+class TestInternCache(unittest.TestCase):
+    def setUp(self):
+        tohil.intern_cache_config(size=1024, max_length=32)
+        tohil.intern_cache_clear()
+
+    def tearDown(self):
+        tohil.intern_cache_config(size=0)
+
+    def test_intern_cache1(self):
+        """repeated dict keys come back as the same str"""
+        rows = tohil.eval(
+            "list [dict create name a size 1] [dict create name b size 2]",
+            to=tohil.auto,
+        )
+        self.assertEqual(rows, [{"name": "a", "size": "1"}, {"name": "b", "size": "2"}])
+        k1 = list(rows[0].keys())
+        k2 = list(rows[1].keys())
+        self.assertIs(k1[0], k2[0])
+        self.assertIs(k1[1], k2[1])
+        info = tohil.intern_cache_info()
+        self.assertEqual(info["hits"], 2)
+        self.assertEqual(info["misses"], 6)
+        self.assertEqual(info["size"], 6)
+        self.assertEqual(info["maxsize"], 1024)
+
+    def test_intern_cache2(self):
+        """long strings, and everything when the cache is off, aren't cached"""
+        tohil.setvar("long", "x" * 33)
+        self.assertIsNot(tohil.getvar("long"), tohil.getvar("long"))
+        self.assertEqual(tohil.intern_cache_info()["size"], 0)
+
+        tohil.intern_cache_config(size=0)
+        tohil.setvar("short", "abc")
+        self.assertIsNot(tohil.getvar("short"), tohil.getvar("short"))
+        self.assertEqual(tohil.intern_cache_info()["hits"], 0)
+
+    def test_intern_cache3(self):
+        """cached strings convert the same as uncached ones"""
+        for s in ("", "abc", "façade", "日本語", "a\x00b", "😀"):
+            tohil.setvar("s", s)
+            self.assertEqual(tohil.getvar("s"), s)
+            self.assertEqual(tohil.getvar("s"), s)
+
+    def test_intern_cache4(self):
+        """bad settings are rejected"""
+        with self.assertRaises(ValueError):
+            tohil.intern_cache_config(size=-1)
+        with self.assertRaises(ValueError):
+            tohil.intern_cache_config(max_length=0)
+        with self.assertRaises(ValueError):
+            tohil.intern_cache_config(max_length=256)
+        tohil.intern_cache_config(size=1000)
+        self.assertEqual(tohil.intern_cache_info()["maxsize"], 1024)
+
+
+if __name__ == "__main__":
+    unittest.main()
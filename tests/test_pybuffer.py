@@ -0,0 +1,61 @@
+import array
+import mmap
+import tempfile
+import unittest
+
+import tohil
+
+
+class TestPyBuffer(unittest.TestCase):
+    def test_pybuffer1(self):
+        """byte buffers of all sorts convert to tcl byte arrays"""
+        data = bytes(range(256))
+        for buf in (bytearray(data), memoryview(data), array.array("B", data)):
+            t = tohil.tclobj(buf)
+            self.assertEqual(t._tcltype, "bytearray")
+            self.assertEqual(bytes(t.as_byte_array()), data)
+        self.assertEqual(str(tohil.tclobj(array.array("i", [1, 2]))), "1 2")
+        self.assertEqual(str(tohil.tclobj(memoryview(b"abcd")[::2])), "97 99")
+
+    def test_pybuffer2(self):
+        """tohil.pybuffer lends tcl the bytes and gets the exporter back"""
+        with tempfile.TemporaryFile() as f:
+            f.write(b"hello world" * 100)
+            f.flush()
+            with mmap.mmap(f.fileno(), 0) as m:
+                t = tohil.pybuffer(m)
+                self.assertEqual(t._tcltype, "pybuffer")
+                tohil.setvar("pybuffer2", t)
+                self.assertIs(tohil.getvar("pybuffer2"), m)
+                self.assertIs(tohil.getvar("pybuffer2", to=tohil.auto), m)
+                self.assertEqual(bytes(memoryview(t)[:5]), b"hello")
+                self.assertEqual(tohil.eval("string length $pybuffer2", to=int), 1100)
+                self.assertEqual(tohil.eval("binary scan $pybuffer2 a5 pybuffer2s; set pybuffer2s"), "hello")
+                del t
+                tohil.unset("pybuffer2")
+
+    def test_pybuffer3(self):
+        """the exporter is held, and can't be resized, while tcl has it"""
+        ba = bytearray(b"a\x00\xff")
+        t = tohil.pybuffer(ba)
+        with self.assertRaises(BufferError):
+            ba.append(1)
+        self.assertEqual(str(t), "a\x00\xff")
+        with self.assertRaises(TypeError):
+            memoryview(t)[0] = 1
+        del t
+        ba.append(1)
+        self.assertEqual(ba, b"a\x00\xff\x01")
+        with self.assertRaises(TypeError):
+            tohil.pybuffer("not a buffer")
+
+    def test_pybuffer4(self):
+        """signed byte buffers are numbers, not bytes"""
+        a = array.array("b", [5, -6])
+        self.assertEqual(tohil.call("llength", a, to=int), 2)
+        self.assertEqual(tohil.call("lindex", a, 1, to=int), -6)
+        self.assertEqual(tohil.tclobj(a)._tcltype, "list")
+
+
+if __name__ == "__main__":
+    unittest.main()
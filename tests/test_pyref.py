@@ -0,0 +1,49 @@
+import sys
+import unittest
+
+import tohil
+
+
+class TestPyRef(unittest.TestCase):
+    def test_pyref1(self):
+        """python objects come back from tcl as themselves"""
+        data = {"a": [1, 2, 3], "b": object()}
+        tohil.setvar("pyref1", tohil.pyref(data))
+        self.assertIs(tohil.getvar("pyref1"), data)
+        self.assertIs(tohil.getvar("pyref1", to=tohil.auto), data)
+        self.assertIs(tohil.eval("set pyref1"), data)
+        self.assertIs(tohil.eval("list $pyref1 $pyref1", to=tohil.auto)[1], data)
+
+    def test_pyref2(self):
+        """tcl passes python objects it's holding back through tohil::call"""
+        seen = []
+        sys.modules["__main__"].pyref2_callback = lambda x: seen.append(x)
+        data = list(range(1000))
+        tohil.eval("proc pyref2 {arg} {set ::pyref2_saved $arg}")
+        tohil.call("pyref2", tohil.pyref(data))
+        tohil.eval("tohil::call pyref2_callback $::pyref2_saved")
+        self.assertIs(seen[0], data)
+
+    def test_pyref3(self):
+        """the string rep is made when tcl wants it"""
+        data = [1, 2, [3, 4]]
+        ref = tohil.pyref(data)
+        self.assertEqual(ref._tcltype, "pyobject")
+        self.assertEqual(tohil.call("llength", ref, to=int), 3)
+        self.assertEqual(str(ref), "1 2 {3 4}")
+        self.assertEqual(tohil.call("string", "length", tohil.pyref("héllo"), to=int), 5)
+
+    def test_pyref4(self):
+        """tcl lets go of the python object when it's done with it"""
+        data = object()
+        count = sys.getrefcount(data)
+        tohil.setvar("pyref4", tohil.pyref(data))
+        self.assertEqual(sys.getrefcount(data), count + 1)
+        tohil.eval("set copy $pyref4; lappend copy x")
+        tohil.unset("pyref4")
+        tohil.unset("copy")
+        self.assertEqual(sys.getrefcount(data), count)
+
+
+if __name__ == "__main__":
+    unittest.main()
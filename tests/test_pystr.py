@@ -0,0 +1,50 @@
+import unittest
+
+import tohil
+
+
+class TestPyStr(unittest.TestCase):
+    def setUp(self):
+        tohil.pystr_cache(True)
+
+    def tearDown(self):
+        tohil.pystr_cache(False)
+
+    def test_pystr1(self):
+        """a tcl string read again comes back as the same str"""
+        tohil.eval("set pystr1 [string repeat héllo 20]")
+        s = tohil.getvar("pystr1")
+        self.assertEqual(s, "héllo" * 20)
+        self.assertIs(tohil.getvar("pystr1"), s)
+        self.assertEqual(tohil.call("::tcl::unsupported::representation", tohil.getvar("pystr1", to=tohil.tclobj)).split()[3], "pystr")
+
+    def test_pystr2(self):
+        """changing the tcl value gets a new str"""
+        tohil.eval("set pystr2 abc; set alias $pystr2")
+        s = tohil.getvar("pystr2")
+        self.assertIs(tohil.getvar("alias"), s)
+        tohil.eval("append pystr2 def")
+        self.assertEqual(tohil.getvar("pystr2"), "abcdef")
+        self.assertIs(tohil.getvar("alias"), s)
+        tohil.eval("lappend alias x")
+        self.assertEqual(tohil.getvar("alias"), "abc x")
+        self.assertEqual(tohil.eval("string length $pystr2", to=int), 6)
+
+    def test_pystr3(self):
+        """objects with other internal reps aren't touched, their elements are"""
+        tohil.eval("set pystr3 [list a b c]")
+        self.assertEqual(tohil.getvar("pystr3"), "a b c")
+        self.assertEqual(tohil.getvar("pystr3", to=tohil.tclobj)._tcltype, "list")
+        self.assertEqual(tohil.getvar("pystr3", to=list), ["a", "b", "c"])
+        tohil.eval("set pystr3 [split {a b c}]")
+        self.assertIs(tohil.getvar("pystr3", to=list)[1], tohil.getvar("pystr3", to=list)[1])
+
+    def test_pystr4(self):
+        """nothing is kept when the cache is off"""
+        tohil.pystr_cache(False)
+        tohil.eval("set pystr4 [string repeat x 100]")
+        self.assertIsNot(tohil.getvar("pystr4"), tohil.getvar("pystr4"))
+
+
+if __name__ == "__main__":
+    unittest.main()
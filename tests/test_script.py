@@ -0,0 +1,38 @@
+import unittest
+
+import tohil
+
+
+class TestScript(unittest.TestCase):
+    def test_script1(self):
+        """tohil.Script with parameters and to= conversion"""
+        add = tohil.Script("expr {$a + $b}", params=["a", "b"])
+        self.assertEqual(add(1, 2), "3")
+        self.assertEqual(add(3, 4, to=int), 7)
+        self.assertEqual(add.params, "a b")
+        self.assertEqual(add.body, "expr {$a + $b}")
+
+    def test_script2(self):
+        """tohil.Script arguments are not substituted"""
+        echo = tohil.Script("return $s", params=["s"], to=str)
+        self.assertEqual(echo("[exit] $nope"), "[exit] $nope")
+
+    def test_script3(self):
+        """tohil.Script defaults, args and errors"""
+        f = tohil.Script("list $a $b $args", params=["a", ["b", "bdef"], "args"], to=list)
+        self.assertEqual(f(1), ["1", "bdef", ""])
+        self.assertEqual(f(1, 2, 3, 4), ["1", "2", "3 4"])
+        with self.assertRaises(tohil.TclError):
+            f()
+        with self.assertRaises(TypeError):
+            f(1, b=2)
+
+    def test_script4(self):
+        """tohil.Script running in a namespace"""
+        tohil.eval("namespace eval ::script_test {variable x 42}")
+        getx = tohil.Script("variable x; return $x", namespace="::script_test", to=int)
+        self.assertEqual(getx(), 42)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,58 @@
+import os
+import tempfile
+import unittest
+
+import tohil
+
+
+class TestSignatureCache(unittest.TestCase):
+    def setUp(self):
+        fd, self.path = tempfile.mkstemp(suffix=".tohilsig")
+        os.close(fd)
+
+    def tearDown(self):
+        tohil.signature_cache(None)
+        os.unlink(self.path)
+
+    def test_signature_cache1(self):
+        """signatures saved by one cache are used by the next"""
+        tohil.eval("""namespace eval ::sigcache {proc f {a {b bdef} args} {return [list $a $b $args]}}""")
+
+        cache = tohil.signature_cache(self.path)
+        t = tohil.import_tcl()
+        self.assertEqual(t.sigcache.f(1, to=list), ["1", "bdef", ""])
+        self.assertEqual(t.string("length", "abc"), "3")
+        self.assertEqual(cache.info()["misses"], 2)
+        tohil.save_signature_cache()
+
+        cache = tohil.signature_cache(self.path)
+        self.assertEqual(cache.info()["size"], 2)
+        t = tohil.import_tcl()
+        self.assertEqual(t.sigcache.f(1, 2, 3, to=list), ["1", "2", "3"])
+        self.assertEqual(t.sigcache.f.defaults, {"b": "bdef"})
+        self.assertFalse(t.string.is_proc)
+        self.assertEqual(cache.info()["hits"], 2)
+        self.assertEqual(cache.info()["misses"], 0)
+
+    def test_signature_cache2(self):
+        """redefined procs aren't taken from the cache"""
+        tohil.eval("""proc ::sigcache2 {a} {return $a}""")
+        cache = tohil.signature_cache(self.path)
+        self.assertEqual(tohil.import_tcl().sigcache2.proc_args, ["a"])
+        tohil.save_signature_cache()
+
+        tohil.eval("""proc ::sigcache2 {a {b 5}} {return $a}""")
+        cache = tohil.signature_cache(self.path)
+        self.assertEqual(tohil.import_tcl().sigcache2.proc_args, ["a", "b"])
+        self.assertEqual(cache.info()["misses"], 1)
+
+    def test_signature_cache3(self):
+        """unusable cache files are ignored"""
+        with open(self.path, "wb") as f:
+            f.write(b"not a cache")
+        cache = tohil.signature_cache(self.path)
+        self.assertEqual(cache.info()["size"], 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -206,6 +206,41 @@ class TestTclObj(unittest.TestCase):
             t.set("foo")
             t.incr()
 
+    def test_tclobj21(self):
+        """tohil.tclobj iteration, to= and length hint"""
+        x = tohil.eval("list 1 2 3 4 5", to=tohil.tclobj)
+        self.assertEqual(list(x), ["1", "2", "3", "4", "5"])
+        x.to = int
+        self.assertEqual([i * 2 for i in x], [2, 4, 6, 8, 10])
+        it = iter(x)
+        self.assertEqual(it.__length_hint__(), 5)
+        next(it)
+        self.assertEqual(it.__length_hint__(), 4)
+        self.assertEqual(list(it), [2, 3, 4, 5])
+        self.assertEqual(it.__length_hint__(), 0)
+        with self.assertRaises(TypeError):
+            iter(tohil.tclobj("a {b"))
+
+    def test_tclobj22(self):
+        """converting a dict doesn't turn it into a list"""
+        x = tohil.eval("dict create a 1 b 2", to=tohil.tclobj)
+
+        def rep(obj):
+            return tohil.call("::tcl::unsupported::representation", obj).split()[3]
+
+        self.assertEqual(rep(x), "dict")
+        self.assertEqual(x.as_dict(), {"a": "1", "b": "2"})
+        self.assertEqual(x.as_list(), ["a", "1", "b", "2"])
+        self.assertEqual(x.as_tuple(), ("a", "1", "b", "2"))
+        self.assertEqual(x.as_set(), {"a", "1", "b", "2"})
+        self.assertEqual(x.as_byte_array(), bytearray(b"a 1 b 2"))
+        self.assertEqual(tohil.call("set", "tclobj22", x, to=dict), {"a": "1", "b": "2"})
+        self.assertEqual(rep(x), "dict")
+
+        y = tohil.eval("list 1 2 3", to=tohil.tclobj)
+        self.assertEqual(y.as_byte_array(), bytearray(b"1 2 3"))
+        self.assertEqual(rep(y), "list")
+
 
 if __name__ == "__main__":
     unittest.main()
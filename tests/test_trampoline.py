@@ -91,6 +91,83 @@ class TestTrampoline(unittest.TestCase):
         }"""
         )
 
+        arg_check_ab = tohil.TclProc("arg_check_ab")
+        self.assertEqual(arg_check_ab.proc_args, ["a", "b", "args"])
+        self.assertEqual(arg_check_ab.defaults, {"b": "default_b"})
+        self.assertEqual(arg_check_ab(1, to=list), ["1", "default_b", ""])
+        self.assertEqual(arg_check_ab(1, 2, 3, 4, to=list), ["1", "2", "3 4"])
+        self.assertEqual(arg_check_ab(1, 2, 3, b=5, to=list), ["1", "5", "2 3"])
+        self.assertEqual(arg_check_ab(a=1, args=[7, 8], to=list), ["1", "default_b", "7 8"])
+
+        with self.assertRaises(TypeError):
+            arg_check_ab(b=2)
+
+    def test_trampoline6(self):
+        """TclProc attributes, to= and C commands"""
+        tohil.eval("""namespace eval ::tramp_ns {proc add-one? {x} {expr {$x + 1}}}""")
+        add_one = tohil.TclProc("::tramp_ns::add-one?", to=int)
+        self.assertTrue(add_one.is_proc)
+        self.assertEqual(add_one.function_name, "add_one_question_mark")
+        self.assertEqual(add_one(5), 6)
+        self.assertEqual(add_one(x=5, to=str), "6")
+        self.assertIs(add_one.to_type, int)
+
+        string_cmd = tohil.TclProc("string")
+        self.assertFalse(string_cmd.is_proc)
+        self.assertIsNone(string_cmd.proc_args)
+        self.assertEqual(string_cmd("toupper", "abc"), "ABC")
+        with self.assertRaises(TypeError):
+            string_cmd("toupper", string="abc")
+
+    def test_trampoline7(self):
+        """TclProcs notice when their proc is redefined"""
+        tohil.eval("proc ::redef_test {a} {return one-$a}")
+        redef_test = tohil.TclProc("::redef_test")
+        self.assertEqual(redef_test("x"), "one-x")
+        tohil.eval("proc ::redef_test {a {b bdef}} {return two-$a-$b}")
+        self.assertEqual(redef_test("x"), "two-x-bdef")
+        self.assertEqual(redef_test.proc_args, ["a", "b"])
+        tohil.eval("rename ::redef_test {}")
+        with self.assertRaises(tohil.TclError):
+            redef_test("x")
+        self.assertFalse(redef_test.is_proc)
+
+    def test_trampoline8(self):
+        """TclNamespace finds procs and namespaces when they're used"""
+        tohil.eval(
+            """namespace eval ::lazy_ns {
+            proc hello {name} {return "hello, $name"}
+            namespace eval child {proc x {} {return x}}
+        }"""
+        )
+        t = tohil.import_tcl()
+        self.assertEqual(t.__tohil_directory__, None)
+        self.assertEqual(t.lazy_ns.hello("world"), "hello, world")
+        self.assertEqual(t.lazy_ns.child.x(), "x")
+        self.assertIn("hello", dir(t.lazy_ns))
+
+        # created after the directory was taken
+        tohil.eval("proc ::lazy_ns::goodbye-now {} {return bye}")
+        self.assertEqual(t.lazy_ns.goodbye_now(), "bye")
+
+        with self.assertRaises(AttributeError):
+            t.lazy_ns.no_such_proc
+
+    def test_trampoline9(self):
+        """procs and namespaces whose names start with two underscores are found"""
+        tohil.eval(
+            """namespace eval ::under_ns {
+            proc __helper {} {return helped}
+            namespace eval __inner {proc y {} {return y}}
+        }"""
+        )
+        t = tohil.import_tcl()
+        # getattr, since t.under_ns.__helper would be mangled in a class
+        self.assertEqual(getattr(t.under_ns, "__helper")(), "helped")
+        self.assertEqual(getattr(t.under_ns, "__inner").y(), "y")
+        with self.assertRaises(AttributeError):
+            t.under_ns.__no_such_thing__
+
 
 # add support for to =; be able to coerce output
 
@@ -37,6 +37,13 @@ class TestVars(unittest.TestCase):
         with self.assertRaises(NameError):
             tohil.getvar("x(d)")
 
+    def test_unset4(self):
+        """exists and unset take var= by keyword"""
+        tohil.setvar("z", 1)
+        self.assertEqual(tohil.exists(var="z"), True)
+        tohil.unset(var="z")
+        self.assertEqual(tohil.exists(var="z"), False)
+
 
 if __name__ == "__main__":
     unittest.main()